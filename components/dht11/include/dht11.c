@@ -1,4 +1,5 @@
 #include "dht11.h"
+#include "dht11_decode.h"
 
 #include <esp_err.h>
 #include <esp_log.h>
@@ -6,22 +7,39 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
+#include "rom/ets_sys.h"
+
 #define TAG "dht11"
-#define TOTAL_DATA_LENGTH 5 // 4 data and 1 checksum
 
-static uint8_t buffer[TOTAL_DATA_LENGTH] = {0};
-static uint8_t temperature = 0;
-static uint8_t humidity = 0;
+#define EXPECTED_EDGES (4 + 2 * DHT11_DATA_BITS)
+// the dht11 has to be held low for at least 18ms to wake, the dht22 for 1ms
+#define DHT11_START_PULSE_MS 20
+#define DHT22_START_PULSE_US 1100
+// a whole reply takes under 5ms
+#define CAPTURE_TIMEOUT_MS 20
+#define REPLY_TIME_US 5000
 
-static int32_t dht11_wait_signal(uint32_t timeout, uint32_t level);
-static esp_err_t IRAM_ATTR dht11_read_data();
+static void IRAM_ATTR dht11_edge_interrupt(void *args);
 
 // https://github.com/FiendChain/ELEC3117-AVR-PostBox/blob/master/PostBox/PostBox/lib/dht11/dht11.h
 // https://www.mouser.com/datasheet/2/758/DHT11-Technical-Data-Sheet-Translated-Version-1143054.pdf
 
-esp_err_t dht11_init() {
+static inline uint32_t read_ccount() {
+    uint32_t ccount;
+    __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount));
+    return ccount;
+}
+
+esp_err_t dht11_sensor_init(dht11_sensor *sensor, gpio_num_t pin, dht11_type type) {
+    sensor->pin = pin;
+    sensor->type = type;
+    sensor->total_edges = 0;
+    sensor->capture_task = NULL;
+    sensor->temperature = 0;
+    sensor->humidity = 0;
+
     gpio_config_t config = {
-        .pin_bit_mask = (1u << DHT11_PIN),
+        .pin_bit_mask = (1u << pin),
         .mode = GPIO_MODE_OUTPUT_OD, 
         .pull_down_en = GPIO_PULLDOWN_DISABLE,
         .pull_up_en = GPIO_PULLUP_DISABLE,
@@ -29,105 +47,80 @@ esp_err_t dht11_init() {
     };
 
     if (gpio_config(&config) != ESP_OK) {
-        ESP_LOGE(TAG, "unable to initialise");
+        ESP_LOGE(TAG, "unable to initialise pin %d", pin);
         return ESP_FAIL;
     }
-    return ESP_OK;
-}
+    gpio_set_level(pin, 1);
 
-esp_err_t dht11_read() {
-    /// so we can use os_delay without caused a core meditation error
-    taskENTER_CRITICAL();
-    esp_err_t status = dht11_read_data();
-    taskEXIT_CRITICAL();
-
-    if (status != ESP_OK) {
-        ESP_LOGE(TAG, "failed to read data");
+    // the isr service is shared with pc_io, whoever is first installs it
+    gpio_install_isr_service(0);
+    if (gpio_isr_handler_add(pin, dht11_edge_interrupt, sensor) != ESP_OK) {
+        ESP_LOGE(TAG, "unable to add edge isr on pin %d", pin);
         return ESP_FAIL;
     }
     return ESP_OK;
 }
 
-esp_err_t IRAM_ATTR dht11_read_data() {
-    // pulldown for at least 18ms
-    gpio_set_level(DHT11_PIN, 0);
-    os_delay_us(20000);
-    gpio_set_level(DHT11_PIN, 1);
-
-    // wait for pull down response after 20 to 40 us
-    if (!dht11_wait_signal(60, 0)) {
-        ESP_LOGE(TAG, "start timeout on pull down #1");
-        return ESP_FAIL;
-    }
-    // wait for pull up after 80us
-    if (!dht11_wait_signal(100, 1)) {
-        ESP_LOGE(TAG, "start timeout on pull up");
-        return ESP_FAIL;
-    }
-    // pulls down after 80us
-    if (!dht11_wait_signal(100, 0)) {
-        ESP_LOGE(TAG, "start timeout on pull down #2");
-        return ESP_FAIL;
+esp_err_t dht11_sensor_read(dht11_sensor *sensor) {
+    // pulldown to wake the sensor, other tasks and interrupts keep running
+    sensor->total_edges = 0;
+    sensor->capture_task = xTaskGetCurrentTaskHandle();
+    ulTaskNotifyTake(pdTRUE, 0);
+    gpio_set_level(sensor->pin, 0);
+    if (sensor->type == DHT11_TYPE_DHT22) {
+        // shorter than a tick, and too long a pulse is not answered
+        os_delay_us(DHT22_START_PULSE_US);
+    } else {
+        vTaskDelay(DHT11_START_PULSE_MS / portTICK_PERIOD_MS + 1);
     }
 
-    // DHT11 data signal
-	// Each bit starts with 50us low voltage
-	// and ends with a high voltage
-	// 26-28us means 0
-	// 70us means 1
-    for (int current_byte = 0; current_byte < TOTAL_DATA_LENGTH; current_byte++) {
-        buffer[current_byte] = 0x00;
-        for (int i = 0; i < 8; i++) {
-            // 50us pulldown
-            if (!dht11_wait_signal(70, 1)) {
-                ESP_LOGE(TAG, "timeout pulldown on byte %d bit %d", current_byte, i);
-                return ESP_FAIL;
-            }
-            // read pull up length
-            int32_t duration = dht11_wait_signal(80, 0); 
-            if (!duration) {
-                ESP_LOGE(TAG, "timeout pullup on byte %d bit %d", current_byte, i);
-                return ESP_FAIL;
-            }
-
-            if (duration <= 10 || duration > 80) {
-                ESP_LOGE(TAG, "invalid pullup duration %d", duration);
-                return ESP_FAIL;
-            }
-
-            if (duration <= 30) buffer[current_byte] &= ~(1 << (7-i));
-            else                buffer[current_byte] |= (1 << (7-i));
-        }
-    }
+    // every edge of the reply is timestamped by the isr
+    gpio_set_intr_type(sensor->pin, GPIO_INTR_ANYEDGE);
+    gpio_set_level(sensor->pin, 1);
+    ulTaskNotifyTake(pdTRUE, CAPTURE_TIMEOUT_MS / portTICK_PERIOD_MS + 1);
+    gpio_set_intr_type(sensor->pin, GPIO_INTR_DISABLE);
+    sensor->capture_task = NULL;
 
-    // confirm checksum
-    uint8_t checksum = (buffer[0] + buffer[1] + buffer[2] + buffer[3]) & 0xFF;
-    if (checksum != buffer[4]) {
-        ESP_LOGE(TAG, "failed checksum 0x%x != 0x%x, calculated != expected", checksum, buffer[4]);
-        ESP_LOGE(TAG, "buffer contents are: %d, %d, %d, %d, %d", buffer[0], buffer[1], buffer[2], buffer[3], buffer[4]);
+    uint8_t data[DHT11_DATA_LENGTH];
+    esp_err_t status = dht11_decode(sensor->edges, sensor->total_edges, ets_get_cpu_frequency(), data);
+    if (status != ESP_OK) {
+        ESP_LOGE(TAG, "failed to read pin %d, %d edges: %s", sensor->pin, sensor->total_edges, esp_err_to_name(status));
         return ESP_FAIL;
     }
 
-    temperature = buffer[2];
-    humidity = buffer[0];
+    dht11_decode_values(sensor->type, data, &sensor->temperature, &sensor->humidity);
     return ESP_OK;
 }
 
-int32_t dht11_wait_signal(uint32_t timeout, uint32_t level) {
-    for (uint32_t i = 0; i < timeout; i+=2) {
-        if (gpio_get_level(DHT11_PIN) == level) {
-            return i;
-        }
-        os_delay_us(2); // no 1us timings
+uint32_t dht11_sensor_bus_time_us(const dht11_sensor *sensor) {
+    if (sensor->type == DHT11_TYPE_DHT22) {
+        return DHT22_START_PULSE_US + REPLY_TIME_US;
     }
-    return -1;
+    // the start pulse is rounded up to whole ticks
+    return (DHT11_START_PULSE_MS / portTICK_PERIOD_MS + 1) * portTICK_PERIOD_MS * 1000 + REPLY_TIME_US;
 }
 
-// dht11 only has a resolution of 1'C and 1% RH
-uint8_t dht11_get_temperature() { 
-    return temperature;
+uint32_t dht11_sensor_min_interval_ms(const dht11_sensor *sensor) {
+    return sensor->type == DHT11_TYPE_DHT22 ? 2000 : 1000;
 }
 
-uint8_t dht11_get_humidity() {
-    return humidity;
-}
\ No newline at end of file
+void IRAM_ATTR dht11_edge_interrupt(void *args) {
+    uint32_t now = read_ccount();
+    dht11_sensor *sensor = args;
+    int edge = sensor->total_edges;
+    if (edge >= DHT11_MAX_EDGES) {
+        return;
+    }
+    sensor->edges[edge].time = now;
+    sensor->edges[edge].level = gpio_get_level(sensor->pin);
+    sensor->total_edges = edge + 1;
+
+    // wake the reader as soon as the last bit has ended
+    if (edge + 1 == EXPECTED_EDGES && sensor->capture_task != NULL) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(sensor->capture_task, &woken);
+        if (woken == pdTRUE) {
+            portYIELD_FROM_ISR();
+        }
+    }
+}
@@ -1,16 +1,39 @@
 #ifndef __DHT11_H__
 #define __DHT11_H__
 
+// where the first sensor is wired on the board
 #ifndef DHT11_PIN
 #define DHT11_PIN 2
 #endif
 
+// release of the start pulse, the response and 40 bits, and a few spare
+#define DHT11_MAX_EDGES 96
+
+#include "dht11_decode.h"
+
 #include <esp_err.h>
+#include <driver/gpio.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// one sensor on its own pin, every sensor captures with its own isr
+typedef struct dht11_sensor {
+    gpio_num_t pin;
+    dht11_type type;
+    dht11_edge edges[DHT11_MAX_EDGES];
+    volatile int total_edges;
+    volatile TaskHandle_t capture_task;
+    // tenths of 'C and % RH of the last good read
+    int16_t temperature;
+    uint16_t humidity;
+} dht11_sensor;
 
-esp_err_t dht11_init();
-esp_err_t dht11_read();
-// dht11 only has a resolution of 1'C and 1% RH
-uint8_t dht11_get_temperature();
-uint8_t dht11_get_humidity();
+esp_err_t dht11_sensor_init(dht11_sensor *sensor, gpio_num_t pin, dht11_type type);
+// blocks for the start pulse and the reply, only one read should run at a time
+esp_err_t dht11_sensor_read(dht11_sensor *sensor);
+// how long one read holds the line
+uint32_t dht11_sensor_bus_time_us(const dht11_sensor *sensor);
+// the sensor can not be read more often than this
+uint32_t dht11_sensor_min_interval_ms(const dht11_sensor *sensor);
 
 #endif
@@ -0,0 +1,64 @@
+#include "dht11_decode.h"
+
+#include <string.h>
+
+// each bit is a high pulse, 26-28us means 0 and 70us means 1
+#define BIT_THRESHOLD_US 48
+#define MIN_PULSE_US 8
+#define MAX_PULSE_US 100
+
+esp_err_t dht11_decode(const dht11_edge *edges, int total_edges, uint32_t ticks_per_us, uint8_t *data) {
+    // the bits are the last 40 high pulses, anything before them is the
+    // release of the start pulse and the 80us response of the sensor
+    uint32_t pulses[DHT11_DATA_BITS];
+    int total_pulses = 0;
+    for (int i = 1; i < total_edges; i++) {
+        if (edges[i].level == edges[i-1].level) {
+            // two edges were merged into one interrupt, the widths can not be trusted
+            return ESP_ERR_INVALID_RESPONSE;
+        }
+        if (edges[i-1].level == 1) {
+            pulses[total_pulses % DHT11_DATA_BITS] = (edges[i].time - edges[i-1].time) / ticks_per_us;
+            total_pulses++;
+        }
+    }
+    // the response pulse has to be there as well
+    if (total_pulses < DHT11_DATA_BITS + 1) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    memset(data, 0, DHT11_DATA_LENGTH);
+    for (int i = 0; i < DHT11_DATA_BITS; i++) {
+        uint32_t width = pulses[(total_pulses + i) % DHT11_DATA_BITS];
+        if (width < MIN_PULSE_US || width > MAX_PULSE_US) {
+            return ESP_ERR_INVALID_RESPONSE;
+        }
+        if (width > BIT_THRESHOLD_US) {
+            data[i / 8] |= 1 << (7 - i % 8);
+        }
+    }
+
+    uint8_t checksum = (data[0] + data[1] + data[2] + data[3]) & 0xFF;
+    if (checksum != data[4]) {
+        return ESP_ERR_INVALID_CRC;
+    }
+    return ESP_OK;
+}
+
+void dht11_decode_values(dht11_type type, const uint8_t *data, int16_t *temperature, uint16_t *humidity) {
+    if (type == DHT11_TYPE_DHT22) {
+        // 16 bit tenths, the top bit of the temperature is its sign
+        *humidity = (data[0] << 8) | data[1];
+        *temperature = ((data[2] & 0x7F) << 8) | data[3];
+        if (data[2] & 0x80) {
+            *temperature = -*temperature;
+        }
+        return;
+    }
+    // whole units and a decimal byte, newer dht11 set the top bit for negative temperatures
+    *humidity = data[0] * 10 + data[1];
+    *temperature = data[2] * 10 + (data[3] & 0x7F);
+    if (data[3] & 0x80) {
+        *temperature = -*temperature;
+    }
+}
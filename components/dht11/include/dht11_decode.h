@@ -0,0 +1,27 @@
+#ifndef __DHT11_DECODE_H__
+#define __DHT11_DECODE_H__
+
+#include <stdint.h>
+#include <esp_err.h>
+
+// both talk the same protocol, they only differ in how the bytes are used
+typedef enum dht11_type {
+    DHT11_TYPE_DHT11,
+    DHT11_TYPE_DHT22
+} dht11_type;
+
+#define DHT11_DATA_LENGTH 5 // 4 data and 1 checksum
+#define DHT11_DATA_BITS (DHT11_DATA_LENGTH * 8)
+
+// edges of one transaction, the line level right after each edge and when it happened
+typedef struct dht11_edge {
+    uint32_t time;
+    uint8_t level;
+} dht11_edge;
+
+// no driver calls, so recorded traces can be replayed off the device
+esp_err_t dht11_decode(const dht11_edge *edges, int total_edges, uint32_t ticks_per_us, uint8_t *data);
+// temperature in tenths of 'C and humidity in tenths of % RH
+void dht11_decode_values(dht11_type type, const uint8_t *data, int16_t *temperature, uint16_t *humidity);
+
+#endif
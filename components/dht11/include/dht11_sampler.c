@@ -0,0 +1,256 @@
+#include "dht11.h"
+#include "dht11_sampler.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+#include <stdlib.h>
+
+#define TAG "dht11-sampler"
+
+typedef struct dht11_sampler_listener_node {
+    dht11_sampler_listener_t listener;
+    void *args;
+    struct dht11_sampler_listener_node *next;
+} dht11_sampler_listener_node;
+
+typedef struct sampler_sensor {
+    dht11_sampler_read_t read;
+    void *sensor;
+    uint32_t bus_time_us;
+    uint32_t min_interval_ms;
+    int64_t next_read;
+} sampler_sensor;
+
+#define BUS_WINDOW_US 1000000
+
+static sampler_sensor sensors[DHT11_SAMPLER_MAX_SENSORS];
+static int total_sensors = 0;
+static dht11_reading cache[DHT11_SAMPLER_MAX_SENSORS] = {0};
+static uint32_t interval_ms = DHT11_SAMPLE_INTERVAL_MS;
+static dht11_sampler_listener_node *listeners = NULL;
+static SemaphoreHandle_t listeners_lock = NULL;
+
+static dht11_sampler_bus_stats bus_stats = {.budget_us = DHT11_SAMPLER_BUS_BUDGET_US};
+static int64_t bus_window_start = 0;
+static uint32_t bus_window_us = 0;
+
+static void dht11_sampler_task(void *args);
+static esp_err_t read_dht(void *sensor, int16_t *temperature, uint16_t *humidity);
+// returns how long the read itself held the bus, listeners not included
+static int64_t read_sensor(int index);
+static void roll_bus_window(int64_t now);
+static void delay_us(int64_t us);
+
+int dht11_sampler_add(dht11_sampler_read_t read, void *sensor, uint32_t bus_time_us, uint32_t min_interval_ms) {
+    if (read == NULL || total_sensors >= DHT11_SAMPLER_MAX_SENSORS || listeners_lock != NULL) {
+        return -1;
+    }
+    int index = total_sensors;
+    sensors[index].read = read;
+    sensors[index].sensor = sensor;
+    sensors[index].bus_time_us = bus_time_us;
+    sensors[index].min_interval_ms = min_interval_ms;
+    cache[index].sensor = index;
+    total_sensors++;
+    return index;
+}
+
+int dht11_sampler_add_dht(dht11_sensor *sensor) {
+    return dht11_sampler_add(read_dht, sensor, dht11_sensor_bus_time_us(sensor), dht11_sensor_min_interval_ms(sensor));
+}
+
+esp_err_t dht11_sampler_init() {
+    if (total_sensors == 0) {
+        ESP_LOGW(TAG, "No sensors to sample");
+        return ESP_ERR_INVALID_STATE;
+    }
+    listeners_lock = xSemaphoreCreateMutex();
+    if (xTaskCreate(dht11_sampler_task, "dht11-task", DHT11_SAMPLER_STACK_SIZE, NULL, 4, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start sampler task");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t dht11_sampler_set_interval(uint32_t interval) {
+    if (interval < DHT11_MIN_INTERVAL_MS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    interval_ms = interval;
+    return ESP_OK;
+}
+
+int dht11_sampler_count() {
+    return total_sensors;
+}
+
+void dht11_sampler_get(dht11_reading *reading) {
+    portENTER_CRITICAL();
+    *reading = cache[0];
+    portEXIT_CRITICAL();
+}
+
+esp_err_t dht11_sampler_get_sensor(int sensor, dht11_reading *reading) {
+    if (sensor < 0 || sensor >= total_sensors) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL();
+    *reading = cache[sensor];
+    portEXIT_CRITICAL();
+    return ESP_OK;
+}
+
+void dht11_sampler_get_bus_stats(dht11_sampler_bus_stats *stats) {
+    portENTER_CRITICAL();
+    *stats = bus_stats;
+    portEXIT_CRITICAL();
+}
+
+esp_err_t dht11_sampler_listen(dht11_sampler_listener_t listener, void *args) {
+    if (listener == NULL) {
+        return ESP_FAIL;
+    }
+    if (listeners_lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    dht11_sampler_listener_node *node = malloc(sizeof(dht11_sampler_listener_node));
+    if (node == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    node->listener = listener;
+    node->args = args;
+
+    xSemaphoreTake(listeners_lock, portMAX_DELAY);
+    node->next = listeners;
+    listeners = node;
+    xSemaphoreGive(listeners_lock);
+    return ESP_OK;
+}
+
+esp_err_t dht11_sampler_unlisten(dht11_sampler_listener_t listener, void *args) {
+    esp_err_t status = ESP_FAIL;
+    xSemaphoreTake(listeners_lock, portMAX_DELAY);
+    dht11_sampler_listener_node **head = &listeners;
+    while (*head != NULL) {
+        dht11_sampler_listener_node *node = *head;
+        if (node->listener == listener && node->args == args) {
+            *head = node->next;
+            free(node);
+            status = ESP_OK;
+            break;
+        }
+        head = &(node->next);
+    }
+    xSemaphoreGive(listeners_lock);
+    return status;
+}
+
+void dht11_sampler_task(void *args) {
+    // spread the sensors over one interval so their reads never bunch up
+    int64_t start = esp_timer_get_time();
+    bus_window_start = start;
+    for (int i = 0; i < total_sensors; i++) {
+        sensors[i].next_read = start + (int64_t)interval_ms * 1000 * i / total_sensors;
+    }
+
+    while (1) {
+        // one task reads every sensor, so two transactions never overlap
+        int next = 0;
+        for (int i = 1; i < total_sensors; i++) {
+            if (sensors[i].next_read < sensors[next].next_read) {
+                next = i;
+            }
+        }
+        sampler_sensor *sensor = &sensors[next];
+
+        int64_t now = esp_timer_get_time();
+        if (sensor->next_read > now) {
+            delay_us(sensor->next_read - now);
+            continue;
+        }
+        roll_bus_window(now);
+        // a read longer than the whole budget still gets a second to itself
+        if (bus_window_us != 0 && bus_window_us + sensor->bus_time_us > DHT11_SAMPLER_BUS_BUDGET_US) {
+            portENTER_CRITICAL();
+            bus_stats.deferred++;
+            portEXIT_CRITICAL();
+            delay_us(bus_window_start + BUS_WINDOW_US - now);
+            continue;
+        }
+
+        bus_window_us += read_sensor(next);
+
+        uint32_t interval = MAX(interval_ms, sensor->min_interval_ms);
+        sensor->next_read += (int64_t)interval * 1000;
+        if (sensor->next_read < now) {
+            // fell behind, do not catch up with a burst of reads
+            sensor->next_read = now + (int64_t)interval * 1000;
+        }
+    }
+}
+
+int64_t read_sensor(int index) {
+    int16_t temperature = 0;
+    uint16_t humidity = 0;
+    int64_t start = esp_timer_get_time();
+    esp_err_t status = sensors[index].read(sensors[index].sensor, &temperature, &humidity);
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL();
+    dht11_reading *entry = &cache[index];
+    entry->reads++;
+    if (status == ESP_OK) {
+        entry->temperature = temperature;
+        entry->humidity = humidity;
+        entry->timestamp = now;
+        entry->consecutive_failures = 0;
+    } else {
+        entry->failures++;
+        entry->consecutive_failures++;
+    }
+    dht11_reading reading = *entry;
+    portEXIT_CRITICAL();
+
+    if (status == ESP_OK) {
+        xSemaphoreTake(listeners_lock, portMAX_DELAY);
+        for (dht11_sampler_listener_node *node = listeners; node != NULL; node = node->next) {
+            node->listener(&reading, node->args);
+        }
+        xSemaphoreGive(listeners_lock);
+    }
+    return now - start;
+}
+
+void roll_bus_window(int64_t now) {
+    int64_t elapsed = now - bus_window_start;
+    if (elapsed < BUS_WINDOW_US) {
+        return;
+    }
+    // a window that was skipped entirely had no reads in it
+    uint32_t last = elapsed < 2 * BUS_WINDOW_US ? bus_window_us : 0;
+    portENTER_CRITICAL();
+    bus_stats.bus_us = last;
+    bus_stats.max_bus_us = MAX(bus_stats.max_bus_us, last);
+    portEXIT_CRITICAL();
+    bus_window_start = now - elapsed % BUS_WINDOW_US;
+    bus_window_us = 0;
+}
+
+void delay_us(int64_t us) {
+    int64_t tick_us = portTICK_PERIOD_MS * 1000;
+    vTaskDelay(MAX((us + tick_us - 1) / tick_us, 1));
+}
+
+esp_err_t read_dht(void *sensor, int16_t *temperature, uint16_t *humidity) {
+    dht11_sensor *dht = sensor;
+    if (dht11_sensor_read(dht) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    *temperature = dht->temperature;
+    *humidity = dht->humidity;
+    return ESP_OK;
+}
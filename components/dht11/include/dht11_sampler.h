@@ -0,0 +1,67 @@
+#ifndef __DHT11_SAMPLER_H__
+#define __DHT11_SAMPLER_H__
+
+#include "dht11.h"
+
+#include <stdint.h>
+#include <esp_err.h>
+
+// the dht11 can not be read more than once a second
+#define DHT11_MIN_INTERVAL_MS 1000
+#ifndef DHT11_SAMPLE_INTERVAL_MS
+#define DHT11_SAMPLE_INTERVAL_MS 2000
+#endif
+#ifndef DHT11_SAMPLER_MAX_SENSORS
+#define DHT11_SAMPLER_MAX_SENSORS 4
+#endif
+// listeners run on the sampler task, the sensor history writes nvs from it once an hour
+#ifndef DHT11_SAMPLER_STACK_SIZE
+#define DHT11_SAMPLER_STACK_SIZE 3072
+#endif
+// how long reads may hold the lines per second, reads past it are postponed
+#ifndef DHT11_SAMPLER_BUS_BUDGET_US
+#define DHT11_SAMPLER_BUS_BUDGET_US 100000
+#endif
+
+typedef struct dht11_reading {
+    // index the sensor was added with, sensor 0 is the primary one
+    uint8_t sensor;
+    // tenths of 'C and % RH
+    int16_t temperature;
+    uint16_t humidity;
+    // esp_timer time of the last good read, 0 before the first one
+    int64_t timestamp;
+    uint32_t reads;
+    uint32_t failures;
+    uint32_t consecutive_failures;
+} dht11_reading;
+
+typedef struct dht11_sampler_bus_stats {
+    // time spent in reads during the last whole second and the worst second
+    uint32_t bus_us;
+    uint32_t max_bus_us;
+    uint32_t budget_us;
+    // reads that were pushed back to stay within the budget
+    uint32_t deferred;
+} dht11_sampler_bus_stats;
+
+// called from the sampler task after every good read
+typedef void (*dht11_sampler_listener_t)(const dht11_reading *, void *);
+// reads any kind of sensor into tenths of 'C and % RH
+typedef esp_err_t (*dht11_sampler_read_t)(void *sensor, int16_t *temperature, uint16_t *humidity);
+
+// sensors are added before init, returns the index of the sensor or -1
+int dht11_sampler_add(dht11_sampler_read_t read, void *sensor, uint32_t bus_time_us, uint32_t min_interval_ms);
+int dht11_sampler_add_dht(dht11_sensor *sensor);
+// reads the sensors one at a time in the background, readers only ever see the cache
+esp_err_t dht11_sampler_init();
+esp_err_t dht11_sampler_listen(dht11_sampler_listener_t listener, void *args);
+esp_err_t dht11_sampler_unlisten(dht11_sampler_listener_t listener, void *args);
+esp_err_t dht11_sampler_set_interval(uint32_t interval_ms);
+int dht11_sampler_count();
+// the primary sensor
+void dht11_sampler_get(dht11_reading *reading);
+esp_err_t dht11_sampler_get_sensor(int sensor, dht11_reading *reading);
+void dht11_sampler_get_bus_stats(dht11_sampler_bus_stats *stats);
+
+#endif
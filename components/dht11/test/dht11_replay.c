@@ -0,0 +1,110 @@
+// replays the edge traces in traces/ through dht11_decode and checks what comes out
+// a trace is a ticks_per_us line and then one "ccount level" line per edge, as
+// dht11_sensor captures them, lines starting with # are comments
+// build and run with `make test`
+#include "dht11_decode.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_EDGES 128
+#define TRACE_DIRECTORY "traces/"
+
+typedef struct replay {
+    const char *trace;
+    dht11_type type;
+    esp_err_t result;
+    // only checked when the trace decodes
+    int16_t temperature;
+    uint16_t humidity;
+} replay;
+
+static const replay replays[] = {
+    {"dht11_good.txt", DHT11_TYPE_DHT11, ESP_OK, 230, 450},
+    {"dht11_decimal_wrap.txt", DHT11_TYPE_DHT11, ESP_OK, 217, 380},
+    {"dht11_checksum.txt", DHT11_TYPE_DHT11, ESP_ERR_INVALID_CRC, 0, 0},
+    {"dht11_truncated.txt", DHT11_TYPE_DHT11, ESP_ERR_TIMEOUT, 0, 0},
+    {"dht11_merged.txt", DHT11_TYPE_DHT11, ESP_ERR_INVALID_RESPONSE, 0, 0},
+    {"dht22_good.txt", DHT11_TYPE_DHT22, ESP_OK, 250, 500},
+    {"dht22_negative.txt", DHT11_TYPE_DHT22, ESP_OK, -101, 652},
+};
+
+static int load_trace(const char *name, dht11_edge *edges, uint32_t *ticks_per_us) {
+    char path[128];
+    snprintf(path, sizeof(path), TRACE_DIRECTORY "%s", name);
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        printf("can not open %s\n", path);
+        return -1;
+    }
+    char line[128];
+    int total_edges = 0;
+    *ticks_per_us = 0;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        unsigned long time;
+        unsigned int level;
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        if (sscanf(line, "ticks_per_us %u", ticks_per_us) == 1) {
+            continue;
+        }
+        if (sscanf(line, "%lu %u", &time, &level) != 2 || level > 1 || total_edges >= MAX_EDGES) {
+            printf("%s: bad line %s", path, line);
+            total_edges = -1;
+            break;
+        }
+        edges[total_edges].time = time;
+        edges[total_edges].level = level;
+        total_edges++;
+    }
+    fclose(file);
+    if (*ticks_per_us == 0) {
+        printf("%s: no ticks_per_us\n", path);
+        return -1;
+    }
+    return total_edges;
+}
+
+static int run(const replay *replay) {
+    dht11_edge edges[MAX_EDGES];
+    uint32_t ticks_per_us;
+    int total_edges = load_trace(replay->trace, edges, &ticks_per_us);
+    if (total_edges < 0) {
+        return 1;
+    }
+
+    uint8_t data[DHT11_DATA_LENGTH];
+    esp_err_t result = dht11_decode(edges, total_edges, ticks_per_us, data);
+    if (result != replay->result) {
+        printf("FAIL %s: decoded to 0x%x, expected 0x%x\n", replay->trace, result, replay->result);
+        return 1;
+    }
+    if (result != ESP_OK) {
+        printf("ok %s: 0x%x\n", replay->trace, result);
+        return 0;
+    }
+
+    int16_t temperature;
+    uint16_t humidity;
+    dht11_decode_values(replay->type, data, &temperature, &humidity);
+    if (temperature != replay->temperature || humidity != replay->humidity) {
+        printf("FAIL %s: %d/10 'C %u/10 %%, expected %d/10 'C %u/10 %%\n", replay->trace,
+                temperature, humidity, replay->temperature, replay->humidity);
+        return 1;
+    }
+    printf("ok %s: %d/10 'C %u/10 %%\n", replay->trace, temperature, humidity);
+    return 0;
+}
+
+int main() {
+    int failures = 0;
+    for (int i = 0; i < sizeof(replays) / sizeof(replays[0]); i++) {
+        failures += run(&replays[i]);
+    }
+    if (failures) {
+        printf("%d traces failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
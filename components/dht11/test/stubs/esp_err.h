@@ -0,0 +1,13 @@
+// host stand-in for the sdk header, with the codes dht11_decode returns
+#ifndef __ESP_ERR_H__
+#define __ESP_ERR_H__
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_TIMEOUT 0x107
+#define ESP_ERR_INVALID_RESPONSE 0x108
+#define ESP_ERR_INVALID_CRC 0x109
+
+#endif
@@ -1,29 +1,72 @@
 #include "pc_io.h"
 #include "pc_io_interrupt.h"
+#include "pc_io_log.h"
 
 #include "driver/gpio.h"
 
 #include "FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/timers.h"
+#include "freertos/queue.h"
 
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #define GPIO_PIN_TO_MASK(x) (1 << x)
 
 #define TAG "pc-io"
 
-static TimerHandle_t power_on_timer = NULL;
-static TimerHandle_t reset_timer = NULL;
-static TimerHandle_t power_off_timer = NULL;
-
-static void pc_io_power_on_task(TimerHandle_t handle);
-static void pc_io_reset_task(TimerHandle_t handle);
-static void pc_io_power_off_task(TimerHandle_t handle);
-
-static bool pc_io_busy = false;
-
-static esp_err_t start_pc_io_timer(TimerHandle_t handle);
+// how often a step that waits for the pc checks its status
+#define STATUS_POLL_MS 100
+#define MAX_STEPS 3
+
+typedef enum pc_io_action {
+    // press the power switch for duration and wait for the pc to come on, skipped if it is on
+    PC_IO_ACTION_POWER_ON,
+    // hold the power switch until the pc is off or duration passed, skipped if it is off
+    PC_IO_ACTION_HARD_OFF,
+    PC_IO_ACTION_PRESS_RESET,
+    PC_IO_ACTION_WAIT
+} pc_io_action;
+
+typedef enum pc_io_wait {
+    PC_IO_WAIT_DEADLINE,
+    // or until the power status is reached, whichever is first
+    PC_IO_WAIT_OFF,
+    PC_IO_WAIT_ON
+} pc_io_wait;
+
+typedef struct pc_io_step {
+    pc_io_action action;
+    uint32_t duration_ms;
+} pc_io_step;
+
+typedef struct pc_io_sequence {
+    int steps;
+    pc_io_step step[MAX_STEPS];
+} pc_io_sequence;
+
+typedef struct pc_io_request {
+    pc_io_command command;
+    pc_io_progress_t progress;
+    void *args;
+} pc_io_request;
+
+static const pc_io_sequence sequences[] = {
+    [PC_IO_COMMAND_POWER_ON] = {1, {{PC_IO_ACTION_POWER_ON, PC_IO_PRESS_MS}}},
+    [PC_IO_COMMAND_POWER_OFF] = {1, {{PC_IO_ACTION_HARD_OFF, PC_IO_HARD_OFF_MS}}},
+    [PC_IO_COMMAND_RESET] = {1, {{PC_IO_ACTION_PRESS_RESET, PC_IO_PRESS_MS}}},
+    [PC_IO_COMMAND_POWER_CYCLE] = {3, {
+        {PC_IO_ACTION_HARD_OFF, PC_IO_HARD_OFF_MS},
+        {PC_IO_ACTION_WAIT, PC_IO_CYCLE_WAIT_MS},
+        {PC_IO_ACTION_POWER_ON, PC_IO_PRESS_MS}
+    }},
+};
+
+static xQueueHandle command_queue = NULL;
+
+static void pc_io_task(void *args);
+static esp_err_t run_step(const pc_io_step *step);
+static void wait_until(int64_t deadline, pc_io_wait until);
 
 void pc_io_init() {
     ESP_LOGD(TAG, "Initialising pc io");
@@ -44,67 +87,117 @@ void pc_io_init() {
 
     pc_io_interrupt_init();
 
-    // create async timers for tasks
-    power_on_timer = xTimerCreate("power-on-timer", 0, pdFALSE, NULL, pc_io_power_on_task);
-    reset_timer = xTimerCreate("reset-timer", 0, pdFALSE, NULL, pc_io_reset_task);
-    power_off_timer = xTimerCreate("power-off-timer", 0, pdFALSE, NULL, pc_io_power_off_task);
+    // commands run one after the other in their own task, never in the timer service
+    command_queue = xQueueCreate(PC_IO_QUEUE_LENGTH, sizeof(pc_io_request));
+    xTaskCreate(pc_io_task, "pc-io-task", 2048, NULL, 5, NULL);
 
     ESP_LOGD(TAG, "Finished initialising pc io");
 }
 
-esp_err_t start_pc_io_timer(TimerHandle_t handle) {
-    if (!pc_io_busy) {
-        pc_io_busy = true;
-        xTimerStart(handle, 0);
-        ESP_LOGD(TAG, "pc io executed timer");
-        return ESP_OK;
+esp_err_t pc_io_submit(pc_io_command command, pc_io_progress_t progress, void *args) {
+    if (command > PC_IO_COMMAND_POWER_CYCLE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pc_io_request request = {
+        .command = command,
+        .progress = progress,
+        .args = args
+    };
+    if (xQueueSend(command_queue, &request, 0) != pdTRUE) {
+        ESP_LOGD(TAG, "pc io queue full");
+        return ESP_ERR_NO_MEM;
     }
-    ESP_LOGD(TAG, "pc io busy");
-    return ESP_FAIL;
+    return ESP_OK;
 }
 
 esp_err_t pc_io_power_on() {
-    if (!pc_io_is_powered()) {
-        return start_pc_io_timer(power_on_timer);
-    }
-    return ESP_OK;
+    return pc_io_submit(PC_IO_COMMAND_POWER_ON, NULL, NULL);
 }
 
 esp_err_t pc_io_reset() {
-    return start_pc_io_timer(reset_timer);
+    return pc_io_submit(PC_IO_COMMAND_RESET, NULL, NULL);
 }
 
 esp_err_t pc_io_power_off() {
-    if (pc_io_is_powered()) {
-        return start_pc_io_timer(power_off_timer);
-    }
-    return ESP_OK;
+    return pc_io_submit(PC_IO_COMMAND_POWER_OFF, NULL, NULL);
 }
 
 bool pc_io_is_powered() {
     return gpio_get_level(POWER_STATUS_PIN);
 }
 
-void pc_io_power_on_task(TimerHandle_t handle) {
-    gpio_set_level(POWER_SW_PIN, 1);
-    vTaskDelay(100 / portTICK_RATE_MS);
-    gpio_set_level(POWER_SW_PIN, 0);
-    pc_io_busy = false;
+void pc_io_task(void *args) {
+    pc_io_request request;
+    while (1) {
+        if (xQueueReceive(command_queue, &request, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        const pc_io_sequence *sequence = &sequences[request.command];
+        pc_io_log_command(request.command);
+        for (int i = 0; i < sequence->steps; i++) {
+            esp_err_t status = run_step(&sequence->step[i]);
+            ESP_LOGD(TAG, "command %d step %d: %s", request.command, i, esp_err_to_name(status));
+            if (request.progress != NULL) {
+                pc_io_progress progress = {
+                    .command = request.command,
+                    .step = i,
+                    .steps = sequence->steps,
+                    .status = status
+                };
+                request.progress(&progress, request.args);
+            }
+        }
+    }
 }
 
-void pc_io_reset_task(TimerHandle_t handle) {
-    gpio_set_level(RESET_SW_PIN, 1);
-    vTaskDelay(100 / portTICK_RATE_MS);
-    gpio_set_level(RESET_SW_PIN, 0);
-    pc_io_busy = false;
+esp_err_t run_step(const pc_io_step *step) {
+    int64_t start = esp_timer_get_time();
+    int64_t deadline = start + (int64_t)step->duration_ms * 1000;
+    switch (step->action) {
+    case PC_IO_ACTION_POWER_ON:
+        if (pc_io_is_powered()) {
+            return ESP_OK;
+        }
+        gpio_set_level(POWER_SW_PIN, 1);
+        pc_io_log_expect(true);
+        wait_until(deadline, PC_IO_WAIT_DEADLINE);
+        gpio_set_level(POWER_SW_PIN, 0);
+        // the same deadline the log gives up at, counted from the press
+        wait_until(start + (int64_t)PC_IO_LATENCY_TIMEOUT_MS * 1000, PC_IO_WAIT_ON);
+        return pc_io_is_powered() ? ESP_OK : ESP_ERR_TIMEOUT;
+    case PC_IO_ACTION_HARD_OFF:
+        if (!pc_io_is_powered()) {
+            return ESP_OK;
+        }
+        gpio_set_level(POWER_SW_PIN, 1);
+        pc_io_log_expect(false);
+        wait_until(deadline, PC_IO_WAIT_OFF);
+        gpio_set_level(POWER_SW_PIN, 0);
+        return pc_io_is_powered() ? ESP_ERR_TIMEOUT : ESP_OK;
+    case PC_IO_ACTION_PRESS_RESET:
+        gpio_set_level(RESET_SW_PIN, 1);
+        wait_until(deadline, PC_IO_WAIT_DEADLINE);
+        gpio_set_level(RESET_SW_PIN, 0);
+        return ESP_OK;
+    case PC_IO_ACTION_WAIT:
+        wait_until(deadline, PC_IO_WAIT_DEADLINE);
+        return ESP_OK;
+    }
+    return ESP_ERR_INVALID_ARG;
 }
 
-void pc_io_power_off_task(TimerHandle_t handle) {
-    gpio_set_level(POWER_SW_PIN, 1);
-    for (int i = 0; i < 60 && pc_io_is_powered(); i++) {
-        vTaskDelay(100 / portTICK_RATE_MS);
+void wait_until(int64_t deadline, pc_io_wait until) {
+    // sleeps against the deadline so a slow wakeup does not stretch the step
+    int64_t now = esp_timer_get_time();
+    while (now < deadline) {
+        if (until != PC_IO_WAIT_DEADLINE && pc_io_is_powered() == (until == PC_IO_WAIT_ON)) {
+            return;
+        }
+        int64_t remaining_ms = (deadline - now + 999) / 1000;
+        if (until != PC_IO_WAIT_DEADLINE) {
+            remaining_ms = MIN(remaining_ms, STATUS_POLL_MS);
+        }
+        vTaskDelay(MAX(remaining_ms / portTICK_PERIOD_MS, 1));
+        now = esp_timer_get_time();
     }
-    gpio_set_level(POWER_SW_PIN, 0);
-    pc_io_busy = false;
 }
-
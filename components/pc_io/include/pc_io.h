@@ -13,7 +13,39 @@
 #define POWER_STATUS_PIN 12
 #define POWER_STATUS_FUNC FUNC_GPIO12
 
+// commands wait in this queue while another one runs
+#ifndef PC_IO_QUEUE_LENGTH
+#define PC_IO_QUEUE_LENGTH 4
+#endif
+#define PC_IO_PRESS_MS 100
+// holding the power switch this long forces any pc off
+#define PC_IO_HARD_OFF_MS 6000
+#define PC_IO_CYCLE_WAIT_MS 5000
+
+typedef enum pc_io_command {
+    // times out if the pc is not on PC_IO_LATENCY_TIMEOUT_MS after the press
+    PC_IO_COMMAND_POWER_ON,
+    PC_IO_COMMAND_POWER_OFF,
+    PC_IO_COMMAND_RESET,
+    // hard off, wait PC_IO_CYCLE_WAIT_MS, power on
+    PC_IO_COMMAND_POWER_CYCLE
+} pc_io_command;
+
+typedef struct pc_io_progress {
+    pc_io_command command;
+    // the step that just finished, a command is done once step + 1 == steps
+    uint8_t step;
+    uint8_t steps;
+    // ESP_ERR_TIMEOUT when the pc did not react before the deadline
+    esp_err_t status;
+} pc_io_progress;
+
+// called from the pc_io task after every step of a command
+typedef void (*pc_io_progress_t)(const pc_io_progress *, void *);
+
 void pc_io_init();
+// queues the command, ESP_ERR_NO_MEM if the queue is full
+esp_err_t pc_io_submit(pc_io_command command, pc_io_progress_t progress, void *args);
 esp_err_t pc_io_power_on();
 esp_err_t pc_io_power_off();
 esp_err_t pc_io_reset();
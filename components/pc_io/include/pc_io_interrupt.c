@@ -1,36 +1,65 @@
 #include "pc_io.h"
 #include "pc_io_interrupt.h"
+#include "pc_io_log.h"
 
-#include <stdlib.h>
 #include <stdbool.h>
 
 #include <esp_log.h>
+#include <esp_timer.h>
 #include <driver/gpio.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
-#include <freertos/queue.h>
+
+#include "rom/ets_sys.h"
 
 #define TAG "pc-io-interrupt"
-#define LL_TAG "pc-io-linked-list"
+#define LISTENER_TAG "pc-io-listeners"
 
-typedef struct pc_io_status_listener_node {
+// a slot is written between two increments of its sequence, so an odd
+// sequence means a write is in progress and a changed one a torn read
+typedef struct pc_io_status_listener_slot {
+    volatile uint32_t sequence;
     pc_io_status_listener_t listener;
     void *args;
-    struct pc_io_status_listener_node *next;
-} pc_io_status_listener_node;
-
-static pc_io_status_listener_node *listeners = NULL; 
-static xQueueHandle event_queue = NULL;
+} pc_io_status_listener_slot;
+
+static pc_io_status_listener_slot listeners[PC_IO_MAX_LISTENERS];
+// bit per slot in use, the notifier only visits these
+static volatile uint32_t active_listeners = 0;
+// slot the notifier is calling into, -1 between calls
+static volatile int calling_slot = -1;
+static TaskHandle_t interrupt_task = NULL;
+
+typedef struct pc_io_edge {
+    uint32_t time;
+    // level of the status pin right after the edge, high while powered
+    uint8_t level;
+} pc_io_edge;
+
+// written only by the isr at head and read only by the task at tail
+static pc_io_edge edge_journal[PC_IO_EDGE_JOURNAL_LENGTH];
+static volatile uint32_t journal_head = 0;
+static volatile uint32_t journal_tail = 0;
+static volatile uint32_t dropped_edges = 0;
+static volatile uint32_t debounce_ms = PC_IO_DEBOUNCE_MS;
+static pc_io_interrupt_stats stats = {0};
 
 static void pc_io_interrupt_task(void *arg);
 static void IRAM_ATTR pc_io_status_interrupt(void *ignore);
+static void notify_listeners(bool is_powered);
+static void write_slot(int slot, pc_io_status_listener_t listener, void *args);
+static bool drain_journal(pc_io_edge *last_edge);
 
 static bool last_powered_status = false;
 
+static inline uint32_t read_ccount() {
+    uint32_t ccount;
+    __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount));
+    return ccount;
+}
 
 void pc_io_interrupt_init() {
-    event_queue = xQueueCreate(10, sizeof(uint32_t));
-    xTaskCreate(pc_io_interrupt_task, "pc-io-int-task", 2048, NULL, 10, NULL);
+    xTaskCreate(pc_io_interrupt_task, "pc-io-int-task", 2048, NULL, 10, &interrupt_task);
     gpio_set_intr_type(POWER_STATUS_PIN, GPIO_INTR_ANYEDGE);
     gpio_install_isr_service(0);
     esp_err_t status = gpio_isr_handler_add(POWER_STATUS_PIN, pc_io_status_interrupt, NULL);
@@ -46,42 +75,150 @@ void pc_io_interrupt_init() {
 }
 
 void IRAM_ATTR pc_io_status_interrupt(void *ignore) {
-    uint32_t data = 0;
-    xQueueSendFromISR(event_queue, &data, NULL);
+    uint32_t now = read_ccount();
+    uint32_t head = journal_head;
+    if (head - journal_tail < PC_IO_EDGE_JOURNAL_LENGTH) {
+        pc_io_edge *edge = &edge_journal[head % PC_IO_EDGE_JOURNAL_LENGTH];
+        edge->time = now;
+        edge->level = gpio_get_level(POWER_STATUS_PIN);
+        journal_head = head + 1;
+    } else {
+        // the task reads the pin instead once the line settles, so nothing real is lost
+        dropped_edges++;
+    }
+
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(interrupt_task, &woken);
+    if (woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+esp_err_t pc_io_set_debounce(uint32_t debounce) {
+    if (debounce == 0 || debounce > 1000) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    debounce_ms = debounce;
+    return ESP_OK;
+}
+
+void pc_io_interrupt_get_stats(pc_io_interrupt_stats *copy) {
+    portENTER_CRITICAL();
+    *copy = stats;
+    copy->dropped = dropped_edges;
+    portEXIT_CRITICAL();
+}
+
+bool drain_journal(pc_io_edge *last_edge) {
+    uint32_t head = journal_head;
+    uint32_t tail = journal_tail;
+    if (head == tail) {
+        return false;
+    }
+    *last_edge = edge_journal[(head - 1) % PC_IO_EDGE_JOURNAL_LENGTH];
+    portENTER_CRITICAL();
+    stats.edges += head - tail;
+    portEXIT_CRITICAL();
+    journal_tail = head;
+    return true;
 }
 
 void pc_io_interrupt_task(void *arg) {
-    uint32_t buffer;
+    pc_io_edge last_edge = {read_ccount(), last_powered_status};
+    uint32_t dropped = 0;
     while (1) {
-        if (xQueueReceive(event_queue, &buffer, portMAX_DELAY)) {
-            bool is_powered = pc_io_is_powered();
-            if (last_powered_status == is_powered) continue;
-            last_powered_status = is_powered;
-            pc_io_status_listener_node *head = listeners;
-            int i = 0;
-            while (head != NULL) {
-                ESP_LOGD("pc-io-linked-list", "calling %d", i++);
-                head->listener(is_powered, head->args);
-                head = head->next;
-            }
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        drain_journal(&last_edge);
+        // wait until the line has been quiet for a whole debounce window
+        while (ulTaskNotifyTake(pdTRUE, debounce_ms / portTICK_PERIOD_MS + 1) != 0) {
+            drain_journal(&last_edge);
+        }
+        drain_journal(&last_edge);
+
+        // the last edge holds the settled level, unless later ones did not fit in the journal
+        bool is_powered = last_edge.level;
+        if (dropped_edges != dropped) {
+            dropped = dropped_edges;
+            is_powered = pc_io_is_powered();
+        }
+        if (last_powered_status == is_powered) continue;
+        last_powered_status = is_powered;
+
+        uint32_t latency_us = (read_ccount() - last_edge.time) / ets_get_cpu_frequency();
+        portENTER_CRITICAL();
+        stats.transitions++;
+        stats.last_latency_us = latency_us;
+        stats.max_latency_us = MAX(stats.max_latency_us, latency_us);
+        stats.last_transition = esp_timer_get_time() - latency_us;
+        int64_t transition = stats.last_transition;
+        portEXIT_CRITICAL();
+        pc_io_log_transition(is_powered, transition);
+        notify_listeners(is_powered);
+    }
+}
+
+void notify_listeners(bool is_powered) {
+    uint32_t pending = active_listeners;
+    while (pending != 0) {
+        int slot = __builtin_ctz(pending);
+        pending &= pending - 1;
+
+        // copy the slot without a lock, skip it if it changed meanwhile
+        pc_io_status_listener_slot *entry = &listeners[slot];
+        uint32_t sequence = entry->sequence;
+        calling_slot = slot;
+        __sync_synchronize();
+        pc_io_status_listener_t listener = entry->listener;
+        void *args = entry->args;
+        __sync_synchronize();
+        if ((sequence & 1) == 0 && sequence == entry->sequence && listener != NULL) {
+            ESP_LOGD(LISTENER_TAG, "calling %d", slot);
+            listener(is_powered, args);
         }
+        calling_slot = -1;
     }
 }
 
+void write_slot(int slot, pc_io_status_listener_t listener, void *args) {
+    pc_io_status_listener_slot *entry = &listeners[slot];
+    entry->sequence++;
+    __sync_synchronize();
+    entry->listener = listener;
+    entry->args = args;
+    __sync_synchronize();
+    entry->sequence++;
+}
+
 esp_err_t pc_io_status_listen(pc_io_status_listener_t listener, void *args) {
     if (listener == NULL) {
         return ESP_FAIL;
     }
 
-    pc_io_status_listener_node **head = &listeners;
-    pc_io_status_listener_node *new_node = malloc(sizeof(pc_io_status_listener_node));
-    new_node->listener = listener;
-    new_node->args = args;
-    new_node->next = *head;
-    *head = new_node;
+    // only claiming the slot is locked, the notifier never takes this
+    int slot = -1;
+    portENTER_CRITICAL();
+    for (int i = 0; i < PC_IO_MAX_LISTENERS; i++) {
+        if (listeners[i].listener == NULL && (listeners[i].sequence & 1) == 0) {
+            slot = i;
+            listeners[i].sequence++;
+            break;
+        }
+    }
+    portEXIT_CRITICAL();
+    if (slot < 0) {
+        ESP_LOGW(LISTENER_TAG, "No free listener slot");
+        return ESP_ERR_NO_MEM;
+    }
 
-    ESP_LOGD(LL_TAG, "added node %p, set head to %p", new_node, *head);
+    listeners[slot].listener = listener;
+    listeners[slot].args = args;
+    __sync_synchronize();
+    listeners[slot].sequence++;
 
+    portENTER_CRITICAL();
+    active_listeners |= (1u << slot);
+    portEXIT_CRITICAL();
+    ESP_LOGD(LISTENER_TAG, "added listener %d", slot);
     return ESP_OK;
 }
 
@@ -90,16 +227,22 @@ esp_err_t pc_io_status_unlisten(pc_io_status_listener_t listener, void *args) {
         return ESP_FAIL;
     }
 
-    pc_io_status_listener_node **head = &listeners;
-    while (*head != NULL) {
-        pc_io_status_listener_node *node = *head;
-        if (node->listener == listener && node->args == args) {
-            *head = node->next;
-            ESP_LOGD(LL_TAG, "freed node %p, set head to %p", node, *head);
-            free(node);
-            return ESP_OK;
+    for (int slot = 0; slot < PC_IO_MAX_LISTENERS; slot++) {
+        if (listeners[slot].listener != listener || listeners[slot].args != args) {
+            continue;
+        }
+        portENTER_CRITICAL();
+        active_listeners &= ~(1u << slot);
+        portEXIT_CRITICAL();
+        write_slot(slot, NULL, NULL);
+
+        // a call that had already copied the slot has to finish first,
+        // unless the listener is removing itself
+        while (calling_slot == slot && xTaskGetCurrentTaskHandle() != interrupt_task) {
+            vTaskDelay(1);
         }
-        head = &(node->next);
+        ESP_LOGD(LISTENER_TAG, "removed listener %d", slot);
+        return ESP_OK;
     }
     return ESP_FAIL;
 }
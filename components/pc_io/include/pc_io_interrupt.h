@@ -4,10 +4,38 @@
 #include <stdbool.h>
 #include <esp_err.h>
 
+// listeners live in a fixed table, registering never allocates
+#ifndef PC_IO_MAX_LISTENERS
+#define PC_IO_MAX_LISTENERS 8
+#endif
+
+// edges closer together than this are bounces of one transition
+#ifndef PC_IO_DEBOUNCE_MS
+#define PC_IO_DEBOUNCE_MS 50
+#endif
+// edges the isr can record before the task drains them, a power of two
+#define PC_IO_EDGE_JOURNAL_LENGTH 32
+
 typedef void (*pc_io_status_listener_t)(bool, void *);
 
+typedef struct pc_io_interrupt_stats {
+    uint32_t edges;
+    // edges that did not fit in the journal, the final level is still seen
+    uint32_t dropped;
+    uint32_t transitions;
+    // from the last edge of a transition to its listeners, debounce included
+    uint32_t last_latency_us;
+    uint32_t max_latency_us;
+    // esp_timer time of the last edge of the last transition
+    int64_t last_transition;
+} pc_io_interrupt_stats;
+
 void pc_io_interrupt_init();
+esp_err_t pc_io_set_debounce(uint32_t debounce_ms);
+void pc_io_interrupt_get_stats(pc_io_interrupt_stats *stats);
+// ESP_ERR_NO_MEM once the table is full
 esp_err_t pc_io_status_listen(pc_io_status_listener_t listener, void *args);
+// once this returns the listener is not running and will not be called again
 esp_err_t pc_io_status_unlisten(pc_io_status_listener_t listener, void *args); 
 
 #endif
\ No newline at end of file
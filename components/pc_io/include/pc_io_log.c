@@ -0,0 +1,122 @@
+#include "pc_io_log.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+
+#define TAG "pc-io-log"
+
+typedef struct latency_window {
+    uint32_t samples;
+    uint32_t failures;
+    uint32_t latencies[PC_IO_LATENCY_WINDOW];
+    // press time of the transition that is awaited
+    bool expecting;
+    uint32_t expected_since;
+} latency_window;
+
+static pc_io_log_entry log_entries[PC_IO_LOG_LENGTH];
+static uint32_t log_head = 0;
+// index 0 for powering off, 1 for powering on
+static latency_window windows[2] = {0};
+
+static void append(pc_io_log_type type, uint8_t value, uint32_t time);
+static void expire(uint32_t now);
+
+uint32_t pc_io_log_now() {
+    return esp_timer_get_time() / 1000;
+}
+
+void pc_io_log_command(pc_io_command command) {
+    uint32_t now = pc_io_log_now();
+    portENTER_CRITICAL();
+    expire(now);
+    append(PC_IO_LOG_COMMAND, command, now);
+    portEXIT_CRITICAL();
+}
+
+void pc_io_log_expect(bool powered) {
+    uint32_t now = pc_io_log_now();
+    portENTER_CRITICAL();
+    expire(now);
+    windows[powered].expecting = true;
+    windows[powered].expected_since = now;
+    portEXIT_CRITICAL();
+}
+
+void pc_io_log_transition(bool powered, int64_t time) {
+    uint32_t time_ms = time / 1000;
+    portENTER_CRITICAL();
+    expire(pc_io_log_now());
+    append(PC_IO_LOG_TRANSITION, powered, time_ms);
+    latency_window *window = &windows[powered];
+    if (window->expecting) {
+        // a bounce can be dated slightly before the press was logged
+        uint32_t latency = time_ms - window->expected_since;
+        if ((int32_t)latency < 0) {
+            latency = 0;
+        }
+        window->latencies[window->samples % PC_IO_LATENCY_WINDOW] = latency;
+        window->samples++;
+        window->expecting = false;
+    }
+    portEXIT_CRITICAL();
+}
+
+int pc_io_log_read(pc_io_log_entry *entries, int max) {
+    portENTER_CRITICAL();
+    expire(pc_io_log_now());
+    int total = MIN(MIN(log_head, PC_IO_LOG_LENGTH), max);
+    for (int i = 0; i < total; i++) {
+        entries[i] = log_entries[(log_head - total + i) % PC_IO_LOG_LENGTH];
+    }
+    portEXIT_CRITICAL();
+    return total;
+}
+
+void pc_io_log_get_latency(bool powered, pc_io_latency_stats *stats) {
+    portENTER_CRITICAL();
+    expire(pc_io_log_now());
+    latency_window window = windows[powered];
+    portEXIT_CRITICAL();
+
+    stats->samples = window.samples;
+    stats->failures = window.failures;
+    stats->last_ms = 0;
+    stats->min_ms = 0;
+    stats->max_ms = 0;
+    stats->avg_ms = 0;
+    int total = MIN(window.samples, PC_IO_LATENCY_WINDOW);
+    if (total == 0) {
+        return;
+    }
+    stats->last_ms = window.latencies[(window.samples - 1) % PC_IO_LATENCY_WINDOW];
+    stats->min_ms = UINT32_MAX;
+    uint32_t sum = 0;
+    for (int i = 0; i < total; i++) {
+        stats->min_ms = MIN(stats->min_ms, window.latencies[i]);
+        stats->max_ms = MAX(stats->max_ms, window.latencies[i]);
+        sum += window.latencies[i];
+    }
+    stats->avg_ms = sum / total;
+}
+
+void append(pc_io_log_type type, uint8_t value, uint32_t time) {
+    pc_io_log_entry *entry = &log_entries[log_head % PC_IO_LOG_LENGTH];
+    entry->time = time;
+    entry->type = type;
+    entry->value = value;
+    log_head++;
+}
+
+void expire(uint32_t now) {
+    // called with the log locked, a missing transition is only noticed on the next access
+    for (int powered = 0; powered < 2; powered++) {
+        latency_window *window = &windows[powered];
+        if (window->expecting && now - window->expected_since >= PC_IO_LATENCY_TIMEOUT_MS) {
+            window->expecting = false;
+            window->failures++;
+            append(PC_IO_LOG_TIMEOUT, powered, window->expected_since + PC_IO_LATENCY_TIMEOUT_MS);
+        }
+    }
+}
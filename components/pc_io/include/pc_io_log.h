@@ -0,0 +1,55 @@
+#ifndef __PC_IO_LOG_H__
+#define __PC_IO_LOG_H__
+
+#include "pc_io.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef PC_IO_LOG_LENGTH
+#define PC_IO_LOG_LENGTH 32
+#endif
+// latency statistics cover this many of the latest transitions
+#define PC_IO_LATENCY_WINDOW 8
+// a pc that has not changed state this long after the switch did not react
+#ifndef PC_IO_LATENCY_TIMEOUT_MS
+#define PC_IO_LATENCY_TIMEOUT_MS 10000
+#endif
+
+typedef enum pc_io_log_type {
+    // value is the pc_io_command that started
+    PC_IO_LOG_COMMAND,
+    // value is the new power status
+    PC_IO_LOG_TRANSITION,
+    // value is the power status that never came, logged once noticed but dated at the deadline
+    PC_IO_LOG_TIMEOUT
+} pc_io_log_type;
+
+typedef struct pc_io_log_entry {
+    // milliseconds since boot
+    uint32_t time;
+    uint8_t type;
+    uint8_t value;
+} pc_io_log_entry;
+
+// from pressing the switch to the status pin following, per direction
+typedef struct pc_io_latency_stats {
+    uint32_t samples;
+    uint32_t failures;
+    uint32_t last_ms;
+    uint32_t min_ms;
+    uint32_t max_ms;
+    uint32_t avg_ms;
+} pc_io_latency_stats;
+
+void pc_io_log_command(pc_io_command command);
+// the switch was pressed, the status should become powered
+void pc_io_log_expect(bool powered);
+// time is the esp_timer time the status pin changed
+void pc_io_log_transition(bool powered, int64_t time);
+// copies the entries oldest first and returns how many there were
+int pc_io_log_read(pc_io_log_entry *entries, int max);
+void pc_io_log_get_latency(bool powered, pc_io_latency_stats *stats);
+uint32_t pc_io_log_now();
+
+#endif
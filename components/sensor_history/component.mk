@@ -0,0 +1,3 @@
+# default behaviour
+COMPONENT_ADD_INCLUDEDIRS += include
+COMPONENT_SRCDIRS = include
\ No newline at end of file
@@ -0,0 +1,235 @@
+#include "sensor_history.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <nvs.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <string.h>
+
+#define TAG "sensor-history"
+
+#define NVS_NAMESPACE "history"
+#define NVS_HOUR_KEY "hour"
+#define NVS_HOUR_POSITION_KEY "hour_pos"
+
+static const int32_t tier_seconds[SENSOR_HISTORY_TIERS] = {0, 60, 3600};
+
+typedef struct ring {
+    sensor_history_entry *entries;
+    int length;
+    int head;
+    int count;
+} ring;
+
+// running rollup of the interval that has not finished yet
+typedef struct accumulator {
+    int32_t start;
+    uint32_t count;
+    int32_t temperature_sum;
+    uint32_t humidity_sum;
+    int16_t temperature_min;
+    int16_t temperature_max;
+    uint16_t humidity_min;
+    uint16_t humidity_max;
+} accumulator;
+
+// where the saved ring starts and ends, and when it was saved
+typedef struct saved_position {
+    int32_t time;
+    int16_t head;
+    int16_t count;
+} saved_position;
+
+static sensor_history_entry raw_entries[SENSOR_HISTORY_RAW_LENGTH];
+static sensor_history_entry minute_entries[SENSOR_HISTORY_MINUTE_LENGTH];
+static sensor_history_entry hour_entries[SENSOR_HISTORY_HOUR_LENGTH];
+static ring rings[SENSOR_HISTORY_TIERS] = {
+    {raw_entries, SENSOR_HISTORY_RAW_LENGTH, 0, 0},
+    {minute_entries, SENSOR_HISTORY_MINUTE_LENGTH, 0, 0},
+    {hour_entries, SENSOR_HISTORY_HOUR_LENGTH, 0, 0},
+};
+// index 0 is unused, raw samples are not accumulated
+static accumulator accumulators[SENSOR_HISTORY_TIERS];
+
+static SemaphoreHandle_t history_lock = NULL;
+static bool persist_hours = false;
+// set when an hour is closed, saved by the adding task once it lets go of the lock
+static bool save_pending = false;
+
+static void ring_push(ring *ring, const sensor_history_entry *entry);
+static void accumulate(sensor_history_tier tier, const sensor_history_entry *entry, uint32_t count);
+static void sensor_history_load();
+static void sensor_history_save();
+
+esp_err_t sensor_history_init(bool persist) {
+    history_lock = xSemaphoreCreateMutex();
+    if (history_lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    persist_hours = persist;
+    if (persist_hours) {
+        sensor_history_load();
+    }
+    return ESP_OK;
+}
+
+int32_t sensor_history_now() {
+    return esp_timer_get_time() / 1000000;
+}
+
+int sensor_history_length(sensor_history_tier tier) {
+    return rings[tier].length;
+}
+
+void sensor_history_add(int16_t temperature, uint16_t humidity) {
+    sensor_history_entry sample = {
+        .time = sensor_history_now(),
+        .temperature_min = temperature,
+        .temperature_max = temperature,
+        .temperature_avg = temperature,
+        .humidity_min = humidity,
+        .humidity_max = humidity,
+        .humidity_avg = humidity,
+    };
+    xSemaphoreTake(history_lock, portMAX_DELAY);
+    ring_push(&rings[SENSOR_HISTORY_RAW], &sample);
+    accumulate(SENSOR_HISTORY_MINUTE, &sample, 1);
+    bool save = save_pending;
+    save_pending = false;
+    xSemaphoreGive(history_lock);
+
+    if (save) {
+        sensor_history_save();
+    }
+}
+
+void accumulate(sensor_history_tier tier, const sensor_history_entry *entry, uint32_t count) {
+    accumulator *current = &accumulators[tier];
+    int32_t start = entry->time - (entry->time % tier_seconds[tier]);
+
+    // an entry from a later interval closes the current one
+    if (current->count > 0 && start != current->start) {
+        sensor_history_entry rollup = {
+            .time = current->start,
+            .temperature_min = current->temperature_min,
+            .temperature_max = current->temperature_max,
+            .temperature_avg = current->temperature_sum / (int32_t)current->count,
+            .humidity_min = current->humidity_min,
+            .humidity_max = current->humidity_max,
+            .humidity_avg = current->humidity_sum / current->count,
+        };
+        ring_push(&rings[tier], &rollup);
+        if (tier + 1 < SENSOR_HISTORY_TIERS) {
+            accumulate(tier + 1, &rollup, current->count);
+        } else if (persist_hours) {
+            save_pending = true;
+        }
+        current->count = 0;
+    }
+
+    if (current->count == 0) {
+        current->start = start;
+        current->temperature_sum = 0;
+        current->humidity_sum = 0;
+        current->temperature_min = entry->temperature_min;
+        current->temperature_max = entry->temperature_max;
+        current->humidity_min = entry->humidity_min;
+        current->humidity_max = entry->humidity_max;
+    }
+    // averages stay weighted by the number of samples behind them
+    current->count += count;
+    current->temperature_sum += entry->temperature_avg * (int32_t)count;
+    current->humidity_sum += entry->humidity_avg * count;
+    current->temperature_min = MIN(current->temperature_min, entry->temperature_min);
+    current->temperature_max = MAX(current->temperature_max, entry->temperature_max);
+    current->humidity_min = MIN(current->humidity_min, entry->humidity_min);
+    current->humidity_max = MAX(current->humidity_max, entry->humidity_max);
+}
+
+int sensor_history_read(sensor_history_tier tier, uint32_t from_ago, uint32_t to_ago, sensor_history_entry *entries, int max_entries) {
+    if (tier >= SENSOR_HISTORY_TIERS || history_lock == NULL) {
+        return 0;
+    }
+    int32_t now = sensor_history_now();
+    int32_t from = now - (int32_t)MIN(from_ago, INT32_MAX / 2);
+    int32_t to = now - (int32_t)MIN(to_ago, INT32_MAX / 2);
+
+    int total = 0;
+    xSemaphoreTake(history_lock, portMAX_DELAY);
+    ring *ring = &rings[tier];
+    int oldest = (ring->head - ring->count + ring->length) % ring->length;
+    for (int i = 0; i < ring->count && total < max_entries; i++) {
+        const sensor_history_entry *entry = &ring->entries[(oldest + i) % ring->length];
+        if (entry->time >= from && entry->time <= to) {
+            entries[total++] = *entry;
+        }
+    }
+    xSemaphoreGive(history_lock);
+    return total;
+}
+
+void ring_push(ring *ring, const sensor_history_entry *entry) {
+    ring->entries[ring->head] = *entry;
+    ring->head = (ring->head + 1) % ring->length;
+    if (ring->count < ring->length) {
+        ring->count++;
+    }
+}
+
+void sensor_history_save() {
+    // the hour ring only changes in sensor_history_add, which is what called this,
+    // so it is written as it is stored without the lock, once an hour keeps flash wear negligible
+    ring *ring = &rings[SENSOR_HISTORY_HOUR];
+    saved_position position = {
+        .time = sensor_history_now(),
+        .head = ring->head,
+        .count = ring->count,
+    };
+
+    nvs_handle handle;
+    if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &handle) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open nvs");
+        return;
+    }
+    esp_err_t status = nvs_set_blob(handle, NVS_HOUR_KEY, ring->entries, ring->length * sizeof(sensor_history_entry));
+    if (status == ESP_OK) {
+        status = nvs_set_blob(handle, NVS_HOUR_POSITION_KEY, &position, sizeof(position));
+    }
+    if (status == ESP_OK) {
+        status = nvs_commit(handle);
+    }
+    if (status != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save hours: %s", esp_err_to_name(status));
+    }
+    nvs_close(handle);
+}
+
+void sensor_history_load() {
+    nvs_handle handle;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK) {
+        return;
+    }
+    ring *ring = &rings[SENSOR_HISTORY_HOUR];
+    saved_position position;
+    size_t position_size = sizeof(position);
+    size_t size = ring->length * sizeof(sensor_history_entry);
+    // a ring saved with another length can not be placed back as it is
+    if (nvs_get_blob(handle, NVS_HOUR_POSITION_KEY, &position, &position_size) == ESP_OK
+            && position_size == sizeof(position)
+            && position.head >= 0 && position.head < ring->length
+            && position.count >= 0 && position.count <= ring->length
+            && nvs_get_blob(handle, NVS_HOUR_KEY, ring->entries, &size) == ESP_OK
+            && size == ring->length * sizeof(sensor_history_entry)) {
+        // boot time is meaningless after a restart and time spent powered off is unknown,
+        // so restored hours end at boot
+        for (int i = 0; i < ring->length; i++) {
+            ring->entries[i].time -= position.time;
+        }
+        ring->head = position.head;
+        ring->count = position.count;
+        ESP_LOGI(TAG, "Restored %d hours", ring->count);
+    }
+    nvs_close(handle);
+}
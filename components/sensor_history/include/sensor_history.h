@@ -0,0 +1,48 @@
+#ifndef __SENSOR_HISTORY_H__
+#define __SENSOR_HISTORY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <esp_err.h>
+
+// entries kept per tier, about 6 minutes of 2s samples, 2 hours and 7 days
+#ifndef SENSOR_HISTORY_RAW_LENGTH
+#define SENSOR_HISTORY_RAW_LENGTH 180
+#endif
+#ifndef SENSOR_HISTORY_MINUTE_LENGTH
+#define SENSOR_HISTORY_MINUTE_LENGTH 120
+#endif
+#ifndef SENSOR_HISTORY_HOUR_LENGTH
+#define SENSOR_HISTORY_HOUR_LENGTH 168
+#endif
+
+typedef enum sensor_history_tier {
+    SENSOR_HISTORY_RAW,
+    SENSOR_HISTORY_MINUTE,
+    SENSOR_HISTORY_HOUR,
+    SENSOR_HISTORY_TIERS
+} sensor_history_tier;
+
+// values in tenths of a degree and of a percent
+// time is seconds since boot, entries restored from flash have negative times
+typedef struct sensor_history_entry {
+    int32_t time;
+    int16_t temperature_min;
+    int16_t temperature_max;
+    int16_t temperature_avg;
+    uint16_t humidity_min;
+    uint16_t humidity_max;
+    uint16_t humidity_avg;
+} sensor_history_entry;
+
+// with persist the hour tier is kept in nvs and restored on boot
+esp_err_t sensor_history_init(bool persist);
+// call from a single task, the add that closes an hour saves it to nvs once the lock is released
+void sensor_history_add(int16_t temperature, uint16_t humidity);
+// entries between from_ago and to_ago seconds ago, oldest first
+// raw samples come back with min, max and avg all the same
+int sensor_history_read(sensor_history_tier tier, uint32_t from_ago, uint32_t to_ago, sensor_history_entry *entries, int max_entries);
+int sensor_history_length(sensor_history_tier tier);
+int32_t sensor_history_now();
+
+#endif
@@ -0,0 +1,66 @@
+#!/usr/bin/env python
+# Generates include/shifted_pwm_lut.h, the duty lookup tables for every supported resolution
+# Run `make shifted-pwm-lut` when the curve or MAX_PWM_CYCLES changes
+import argparse
+import os
+
+COMPONENT_DIR = os.path.dirname(os.path.abspath(__file__))
+OUTPUT_PATH = os.path.join(COMPONENT_DIR, "include", "shifted_pwm_lut.h")
+
+# must match shifted_pwm.h
+MAX_PWM_CYCLES = 128
+RESOLUTIONS = range(8, 13)
+
+
+def cie_lightness(x):
+    # CIE 1931 lightness to relative luminance, perceptually even steps
+    lightness = x * 100.0
+    if lightness <= 8.0:
+        return lightness / 903.3
+    return ((lightness + 16.0) / 116.0) ** 3
+
+
+def linear(x):
+    return x
+
+
+def table(curve, duty_max):
+    values = []
+    for i in range(MAX_PWM_CYCLES + 1):
+        values.append(int(round(curve(i / float(MAX_PWM_CYCLES)) * duty_max)))
+    return values
+
+
+def format_table(name, values):
+    lines = ["static const uint16_t %s[MAX_PWM_CYCLES + 1] = {" % name]
+    for i in range(0, len(values), 16):
+        lines.append("    " + ", ".join("%d" % value for value in values[i:i+16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the shifted_pwm duty lookup tables")
+    parser.add_argument("--output", default=OUTPUT_PATH)
+    args = parser.parse_args()
+
+    sections = []
+    for bits in RESOLUTIONS:
+        duty_max = (1 << bits) - 1
+        sections.append("#%s SHIFTED_PWM_RESOLUTION_BITS == %d\n%s\n%s" % (
+            "if" if not sections else "elif", bits,
+            format_table("pwm_linear_lut", table(linear, duty_max)),
+            format_table("pwm_gamma_lut", table(cie_lightness, duty_max))))
+
+    with open(args.output, "w", newline="\n") as file:
+        file.write("// generated by gen_lut.py, do not edit\n")
+        file.write("#ifndef __SHIFTED_PWM_LUT_H__\n")
+        file.write("#define __SHIFTED_PWM_LUT_H__\n\n")
+        file.write('#include "shifted_pwm.h"\n\n')
+        file.write("// input value 0 to MAX_PWM_CYCLES mapped to a duty of 0 to PWM_DUTY_MAX\n")
+        file.write("\n".join(sections))
+        file.write("\n#endif\n\n#endif\n")
+
+
+if __name__ == "__main__":
+    main()
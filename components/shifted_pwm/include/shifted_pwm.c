@@ -1,4 +1,5 @@
 #include "shifted_pwm.h"
+#include "shifted_pwm_lut.h"
 
 #include "driver/gpio.h"
 #include "driver/spi.h"
@@ -7,18 +8,76 @@
 #include "FreeRTOS.h"
 #include "freertos/portmacro.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 
 #include <stdio.h>
 #include <stdbool.h>
+#include <string.h>
 
-static uint8_t pwm_values[MAX_PWM_PINS] = {0, 0, 0, 0, 0, 0, 0, 0};
+// one row of register bytes per cycle, or per bit plane in bam mode
+// followed by one row per dither step, which in pwm mode stand in for the last cycle
+// rows are word aligned so the spi can send straight out of the table
+#define FRAME_LENGTH (MAX_PWM_CYCLES + 1)
+#define FRAME_ROWS (MAX_PWM_CYCLES + PWM_DITHER_STEPS)
+#define FRAME_WORDS ((SHIFTED_PWM_REGISTERS + 3) / 4)
+
+static uint8_t pwm_values[MAX_PWM_PINS] = {0};
+// looked up from the curve a value was set with
+static uint16_t pwm_duties[MAX_PWM_PINS] = {0};
+static shifted_pwm_mode pwm_mode = SHIFTED_PWM_MODE_PWM;
 static uint8_t current_cycle = 0;
-static uint32_t current_value = 0x0000; // cast 32bit for performance?
+static uint8_t current_plane = 0;
+static uint8_t dither_step = 0;
 static spi_trans_t transmission_params = {0};
 
+// the isr only reads the active frame, the other one is rebuilt by tasks
+// a rebuilt frame is swapped in by the isr at the start of the next period
+static uint32_t frames[2][FRAME_ROWS][FRAME_WORDS] = {{{0}}};
+// whether a row differs from the one before it, so unchanged cycles skip the spi
+static bool frame_changes[2][MAX_PWM_CYCLES] = {{0}};
+static volatile uint8_t active_frame = 0;
+static volatile bool swap_pending = false;
+static SemaphoreHandle_t frame_lock = NULL;
+static SemaphoreHandle_t stage_lock = NULL;
+// notified by the isr once a committed frame is swapped in
+static volatile TaskHandle_t frame_waiter = NULL;
+
+#if SHIFTED_PWM_STATS
+static shifted_pwm_stats stats = {0};
+#define STATS_BEGIN() uint32_t stats_start = read_ccount()
+#define STATS_END(period_start) shifted_pwm_count_isr(stats_start, period_start)
+#else
+#define STATS_BEGIN()
+#define STATS_END(period_start) ((void)(period_start))
+#endif
+
 void shifted_pwm_update(void *ignore);
+void shifted_pwm_update_bam(void *ignore);
+static void shifted_pwm_build_frame(uint32_t (*frame)[FRAME_WORDS], bool *changes);
+static void shifted_pwm_set_bit(uint32_t *row, int pin);
+static void shifted_pwm_set_dither(uint32_t (*rows)[FRAME_WORDS], int pin, int bits, unsigned int count);
+static void shifted_pwm_swap();
+static void shifted_pwm_transfer(uint32_t *row);
+#if SHIFTED_PWM_STATS
+static void shifted_pwm_count_isr(uint32_t start, bool period_start);
+#endif
+
+#ifdef __XTENSA__
+static inline uint32_t read_ccount() {
+    uint32_t ccount;
+    __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount));
+    return ccount;
+}
+#else
+// the host simulator in test/ supplies the cycle counter
+uint32_t read_ccount();
+#endif
+
+void shifted_pwm_init(shifted_pwm_mode mode) {
+    pwm_mode = mode;
+    frame_lock = xSemaphoreCreateMutex();
+    stage_lock = xSemaphoreCreateMutex();
 
-void shifted_pwm_init() {
     spi_config_t spi_config;
     // Load default interface parameters
     // CS_EN:1, MISO_EN:1, MOSI_EN:1, BYTE_TX_ORDER:1, BYTE_TX_ORDER:1, BIT_RX_ORDER:0, BIT_TX_ORDER:0, CPHA:0, CPOL:0
@@ -43,33 +102,48 @@ void shifted_pwm_init() {
     spi_init(HSPI_HOST, &spi_config);
 
 
-    transmission_params.mosi = &current_value;
-    transmission_params.bits.mosi = 8;
-    
+    transmission_params.mosi = frames[0][0];
+    transmission_params.bits.mosi = 8 * SHIFTED_PWM_REGISTERS;
 
-    hw_timer_init(shifted_pwm_update, NULL);
+    if (mode == SHIFTED_PWM_MODE_BAM) {
+        hw_timer_init(shifted_pwm_update_bam, NULL);
+    } else {
+        hw_timer_init(shifted_pwm_update, NULL);
+    }
     hw_timer_set_clkdiv(TIMER_CLKDIV_1);
     hw_timer_set_reload(true);
     hw_timer_set_intr_type(TIMER_EDGE_INT);
-    hw_timer_set_load_data(5000);
+    hw_timer_set_load_data(mode == SHIFTED_PWM_MODE_BAM ? BAM_BASE_TICKS << BAM_DITHER_BITS : PWM_CYCLE_TICKS);
     hw_timer_enable(true);
     // hw_timer_alarm_us(51, true);
 }
 
-void shifted_pwm_update(void *ignore) {
-    uint8_t old_value = current_value;
-    if (current_cycle == 0) {
-        current_value = 0xFF;
-    }
-    
-    for (int i = 0; i < MAX_PWM_PINS; i++) {
-        if (current_cycle == pwm_values[i]) {
-            current_value &= ~(1u << i);
+void shifted_pwm_swap() {
+    active_frame ^= 1;
+    swap_pending = false;
+    if (frame_waiter != NULL) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(frame_waiter, &woken);
+        if (woken == pdTRUE) {
+            portYIELD_FROM_ISR();
         }
     }
+}
+
+void shifted_pwm_update(void *ignore) {
+    STATS_BEGIN();
+    bool period_start = current_cycle == 0;
+    if (period_start && swap_pending) {
+        shifted_pwm_swap();
+    }
 
-    if (current_value != old_value) {
-        spi_trans(HSPI_HOST, &transmission_params);
+    if (current_cycle == MAX_PWM_CYCLES) {
+        // the last cycle is this period's dither step, so it is always sent
+        shifted_pwm_transfer(frames[active_frame][MAX_PWM_CYCLES + dither_step]);
+        dither_step = (dither_step + 1) % PWM_DITHER_STEPS;
+    } else if (current_cycle == 0 || frame_changes[active_frame][current_cycle]) {
+        // the first cycle is always sent, the previous row may be from the old frame
+        shifted_pwm_transfer(frames[active_frame][current_cycle]);
     }
 
     current_cycle += 1;
@@ -80,16 +154,238 @@ void shifted_pwm_update(void *ignore) {
         current_cycle = 0;
     }
     #endif
+    STATS_END(period_start);
+}
+
+void shifted_pwm_update_bam(void *ignore) {
+    STATS_BEGIN();
+    bool period_start = current_plane == 0;
+    if (period_start && swap_pending) {
+        shifted_pwm_swap();
+    }
+
+    // loading restarts the count, so a plane lasts for exactly as long as loaded
+    if (BAM_DITHER_BITS > 0 && current_plane == 0) {
+        // the planes too short for an interrupt each, shown as this period's dither step
+        shifted_pwm_transfer(frames[active_frame][BAM_PLANES + dither_step]);
+        hw_timer_set_load_data(BAM_BASE_TICKS << BAM_DITHER_BITS);
+        dither_step = (dither_step + 1) % BAM_DITHER_STEPS;
+        current_plane = BAM_DITHER_BITS;
+    } else {
+        // show plane n of every duty until the next interrupt
+        shifted_pwm_transfer(frames[active_frame][current_plane]);
+        hw_timer_set_load_data(BAM_BASE_TICKS << current_plane);
+        current_plane += 1;
+        if (current_plane >= BAM_PLANES) {
+            current_plane = 0;
+        }
+    }
+    STATS_END(period_start);
+}
+
+void shifted_pwm_transfer(uint32_t *row) {
+    transmission_params.mosi = row;
+    spi_trans(HSPI_HOST, &transmission_params);
+#if SHIFTED_PWM_STATS
+    stats.transfers++;
+#endif
+}
+
+#if SHIFTED_PWM_STATS
+void shifted_pwm_count_isr(uint32_t start, bool period_start) {
+    uint32_t cycles = read_ccount() - start;
+    stats.interrupts++;
+    stats.total_cycles += cycles;
+    if (cycles > stats.max_cycles) {
+        stats.max_cycles = cycles;
+    }
+    if (period_start) {
+        stats.periods++;
+    }
+}
+
+void shifted_pwm_get_stats(shifted_pwm_stats *out) {
+    // the isr updates these, a torn read would mix two interrupts
+    portENTER_CRITICAL();
+    *out = stats;
+    portEXIT_CRITICAL();
+}
+
+void shifted_pwm_reset_stats() {
+    portENTER_CRITICAL();
+    memset(&stats, 0, sizeof(stats));
+    portEXIT_CRITICAL();
+}
+
+void shifted_pwm_output_duty(uint8_t pin, uint32_t *on_ticks, uint32_t *period_ticks) {
+    // decoded from what the isr is actually shifting out, not from the requested value
+    uint8_t frame = active_frame;
+    uint8_t mask = 1u << (pin % 8);
+    int byte = SHIFTED_PWM_REGISTERS - 1 - pin / 8;
+    *on_ticks = 0;
+    if (pwm_mode == SHIFTED_PWM_MODE_BAM) {
+        for (int plane = BAM_DITHER_BITS; plane < BAM_PLANES; plane++) {
+            if (((uint8_t *)frames[frame][plane])[byte] & mask) {
+                *on_ticks += BAM_BASE_TICKS << plane;
+            }
+        }
+        // averaged over the dither steps
+        for (int step = 0; BAM_DITHER_BITS > 0 && step < BAM_DITHER_STEPS; step++) {
+            if (((uint8_t *)frames[frame][BAM_PLANES + step])[byte] & mask) {
+                *on_ticks += BAM_BASE_TICKS;
+            }
+        }
+        *period_ticks = BAM_PERIOD_TICKS;
+        return;
+    }
+    for (int cycle = 0; cycle < MAX_PWM_CYCLES; cycle++) {
+        if (((uint8_t *)frames[frame][cycle])[byte] & mask) {
+            *on_ticks += PWM_CYCLE_TICKS * PWM_DITHER_STEPS;
+        }
+    }
+    for (int step = 0; step < PWM_DITHER_STEPS; step++) {
+        if (((uint8_t *)frames[frame][MAX_PWM_CYCLES + step])[byte] & mask) {
+            *on_ticks += PWM_CYCLE_TICKS;
+        }
+    }
+    *period_ticks = PWM_CYCLE_TICKS * FRAME_LENGTH * PWM_DITHER_STEPS;
 }
+#endif
 
 uint8_t get_pwm_value(uint8_t pin) {
     return pwm_values[pin];
 }
 
+void stage_pwm_value(uint8_t pin, uint8_t value) {
+    stage_pwm_value_curve(pin, value, SHIFTED_PWM_CURVE_LINEAR);
+}
+
+void stage_pwm_value_curve(uint8_t pin, uint8_t value, shifted_pwm_curve curve) {
+    stage_pwm_value_fine(pin, (uint16_t)value << 8, curve);
+}
+
+void stage_pwm_value_fine(uint8_t pin, uint16_t value, shifted_pwm_curve curve) {
+    uint8_t whole = value >> 8;
+    uint8_t fraction = value & 0xFF;
+    if (whole >= MAX_PWM_CYCLES) {
+        whole = MAX_PWM_CYCLES;
+        fraction = 0;
+    }
+    const uint16_t *lut = (curve == SHIFTED_PWM_CURVE_GAMMA) ? pwm_gamma_lut : pwm_linear_lut;
+    uint16_t duty = lut[whole];
+    // steps between table entries are spread over the fraction
+    if (fraction != 0) {
+        duty += ((uint32_t)(lut[whole + 1] - duty) * fraction + 0x80) >> 8;
+    }
+    pwm_values[pin] = whole + (fraction >= 0x80 ? 1 : 0);
+    pwm_duties[pin] = duty;
+}
+
 void set_pwm_value(uint8_t pin, uint8_t value) {
-    if (value > MAX_PWM_CYCLES) {
-        value = MAX_PWM_CYCLES;
+    set_pwm_value_curve(pin, value, SHIFTED_PWM_CURVE_LINEAR);
+}
+
+void set_pwm_value_curve(uint8_t pin, uint8_t value, shifted_pwm_curve curve) {
+    set_pwm_value_fine(pin, (uint16_t)value << 8, curve);
+}
+
+void set_pwm_value_fine(uint8_t pin, uint16_t value, shifted_pwm_curve curve) {
+    shifted_pwm_lock_stage();
+    stage_pwm_value_fine(pin, value, curve);
+    shifted_pwm_commit();
+    shifted_pwm_unlock_stage();
+}
+
+void shifted_pwm_lock_stage() {
+    xSemaphoreTake(stage_lock, portMAX_DELAY);
+}
+
+void shifted_pwm_unlock_stage() {
+    xSemaphoreGive(stage_lock);
+}
+
+void shifted_pwm_commit() {
+    xSemaphoreTake(frame_lock, portMAX_DELAY);
+    // once nothing is pending the isr leaves active_frame alone
+    // so the inactive frame can be rebuilt without tearing
+    swap_pending = false;
+    // frames is not volatile, the barriers keep its stores between the two flag writes
+    __asm__ __volatile__("" ::: "memory");
+    uint8_t next_frame = active_frame ^ 1;
+    shifted_pwm_build_frame(frames[next_frame], frame_changes[next_frame]);
+    __asm__ __volatile__("" ::: "memory");
+    swap_pending = true;
+    xSemaphoreGive(frame_lock);
+}
+
+esp_err_t shifted_pwm_wait_frame(TickType_t timeout) {
+    // left by a swap after an earlier wait stopped looking, it would end this one early
+    ulTaskNotifyTake(pdTRUE, 0);
+    frame_waiter = xTaskGetCurrentTaskHandle();
+    // already swapped in, a notification sent since arming is cleared by the next wait
+    if (!swap_pending) {
+        frame_waiter = NULL;
+        return ESP_OK;
+    }
+    uint32_t notified = ulTaskNotifyTake(pdTRUE, timeout);
+    frame_waiter = NULL;
+    return notified ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+void shifted_pwm_build_frame(uint32_t (*frame)[FRAME_WORDS], bool *changes) {
+    memset(frame, 0, sizeof(frames[0]));
+    if (pwm_mode == SHIFTED_PWM_MODE_BAM) {
+        for (int i = 0; i < MAX_PWM_PINS; i++) {
+            for (int plane = BAM_DITHER_BITS; plane < BAM_PLANES; plane++) {
+                if ((pwm_duties[i] >> plane) & 1u) {
+                    shifted_pwm_set_bit(frame[plane], i);
+                }
+            }
+            // the low bits turn on that many of the steps, a full duty stays on through every step
+            if (BAM_DITHER_BITS > 0) {
+                unsigned int low = pwm_duties[i] & (BAM_DITHER_STEPS - 1);
+                shifted_pwm_set_dither(&frame[BAM_PLANES], i, BAM_DITHER_BITS,
+                        pwm_duties[i] == PWM_DUTY_MAX ? BAM_DITHER_STEPS : low);
+            }
+        }
+        return;
     }
-    pwm_values[pin] = value;
+
+    // a pin is on from the start of the period for its whole cycles, and for
+    // the last cycle in as many dither steps as it has left over
+    for (int i = 0; i < MAX_PWM_PINS; i++) {
+        uint32_t steps = ((uint32_t)pwm_duties[i] * FRAME_LENGTH * PWM_DITHER_STEPS + PWM_DUTY_MAX / 2) / PWM_DUTY_MAX;
+        int cycles = steps / PWM_DITHER_STEPS;
+        if (cycles > MAX_PWM_CYCLES) {
+            cycles = MAX_PWM_CYCLES;
+        }
+        for (int cycle = 0; cycle < cycles; cycle++) {
+            shifted_pwm_set_bit(frame[cycle], i);
+        }
+        shifted_pwm_set_dither(&frame[MAX_PWM_CYCLES], i, PWM_DITHER_BITS, steps - cycles * PWM_DITHER_STEPS);
+    }
+    changes[0] = true;
+    for (int cycle = 1; cycle < MAX_PWM_CYCLES; cycle++) {
+        changes[cycle] = memcmp(frame[cycle], frame[cycle - 1], sizeof(frame[cycle])) != 0;
+    }
+}
+
+void shifted_pwm_set_dither(uint32_t (*rows)[FRAME_WORDS], int pin, int bits, unsigned int count) {
+    // steps are taken in bit reversed order, so the ones turned on are spread out
+    for (unsigned int step = 0; step < (1u << bits); step++) {
+        unsigned int order = 0;
+        for (int bit = 0; bit < bits; bit++) {
+            order |= ((step >> bit) & 1u) << (bits - 1 - bit);
+        }
+        if (order < count) {
+            shifted_pwm_set_bit(rows[step], pin);
+        }
+    }
+}
+
+void shifted_pwm_set_bit(uint32_t *row, int pin) {
+    // bytes go out in memory order and the first one ends up in the last register
+    uint8_t *registers = (uint8_t *)row;
+    registers[SHIFTED_PWM_REGISTERS - 1 - pin / 8] |= 1u << (pin % 8);
 }
 
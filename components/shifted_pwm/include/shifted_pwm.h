@@ -2,12 +2,124 @@
 #define __SHIFTED_PWM_H__
 
 #include <stdint.h>
+#include <esp_err.h>
+#include "FreeRTOS.h"
 
 #define MAX_PWM_CYCLES 128
-#define MAX_PWM_PINS 8
 
-void shifted_pwm_init();
+// number of daisy chained 74HC595s, every register adds 8 channels
+// all registers are shifted out in a single spi burst, at most 64 bytes
+// override for the whole project, e.g. CFLAGS += -DSHIFTED_PWM_REGISTERS=4
+#ifndef SHIFTED_PWM_REGISTERS
+#define SHIFTED_PWM_REGISTERS 1
+#endif
+#if SHIFTED_PWM_REGISTERS < 1 || SHIFTED_PWM_REGISTERS > 8
+#error "SHIFTED_PWM_REGISTERS must be between 1 and 8"
+#endif
+// pin 0 is bit 0 of the register nearest the esp
+#define MAX_PWM_PINS (8 * SHIFTED_PWM_REGISTERS)
+
+// duty resolution of the output, values are mapped onto it through lookup tables
+// pwm mode has MAX_PWM_CYCLES+1 steps a period and dithers the rest, bam mode shows one plane per bit
+#ifndef SHIFTED_PWM_RESOLUTION_BITS
+#define SHIFTED_PWM_RESOLUTION_BITS 10
+#endif
+#if SHIFTED_PWM_RESOLUTION_BITS < 8 || SHIFTED_PWM_RESOLUTION_BITS > 12
+#error "SHIFTED_PWM_RESOLUTION_BITS must be between 8 and 12"
+#endif
+#define PWM_DUTY_MAX ((1u << SHIFTED_PWM_RESOLUTION_BITS) - 1)
+
+// timer ticks (80MHz) per pwm cycle, a period is MAX_PWM_CYCLES+1 cycles
+#define PWM_CYCLE_TICKS 5000
+// the last cycle of a period is on in as many out of every PWM_DITHER_STEPS periods
+// as a duty has left over below whole cycles, 8 steps is still above 15Hz
+#define PWM_DITHER_BITS (SHIFTED_PWM_RESOLUTION_BITS - 7 < 3 ? SHIFTED_PWM_RESOLUTION_BITS - 7 : 3)
+#define PWM_DITHER_STEPS (1 << PWM_DITHER_BITS)
+
+// bit angle modulation splits a period into one plane per duty bit
+// plane n is shown for BAM_BASE_TICKS << n, a period is BAM_PERIOD_TICKS
+// every extra bit halves the base plane, so with one register the period is
+// about 5.1ms from 8 to 11 bits, at 12 bits the base is held at BAM_BURST_TICKS
+// and the period grows to about 14ms, more registers lengthen it as well
+#define BAM_PLANES SHIFTED_PWM_RESOLUTION_BITS
+// no interrupt comes sooner than this after the one before it
+#define BAM_MIN_TIMER_TICKS 1600
+// spi burst of the whole chain plus driver overhead, no plane can be shorter
+#define BAM_BURST_TICKS (32 * SHIFTED_PWM_REGISTERS + 240)
+#ifndef BAM_BASE_TICKS
+#define BAM_PERIOD_BASE_TICKS ((1200 + 400 * SHIFTED_PWM_REGISTERS) >> (SHIFTED_PWM_RESOLUTION_BITS - 8))
+#define BAM_BASE_TICKS (BAM_PERIOD_BASE_TICKS > BAM_BURST_TICKS ? BAM_PERIOD_BASE_TICKS : BAM_BURST_TICKS)
+#endif
+// planes shorter than BAM_MIN_TIMER_TICKS are not shown on their own, together they
+// are one plane as long as the shortest timed one, which is on in as many periods
+// out of every BAM_DITHER_STEPS as their value
+#define BAM_DITHER_BITS (BAM_BASE_TICKS >= BAM_MIN_TIMER_TICKS ? 0 : \
+        (BAM_BASE_TICKS << 1) >= BAM_MIN_TIMER_TICKS ? 1 : \
+        (BAM_BASE_TICKS << 2) >= BAM_MIN_TIMER_TICKS ? 2 : 3)
+#if (BAM_BASE_TICKS << 3) < BAM_MIN_TIMER_TICKS
+#error "BAM_BASE_TICKS is too short to dither into a timed plane"
+#endif
+#define BAM_DITHER_STEPS (1 << BAM_DITHER_BITS)
+// the dither plane is one base plane longer than the planes it stands in for
+#define BAM_PERIOD_TICKS (((uint32_t)BAM_BASE_TICKS << BAM_PLANES) - (BAM_DITHER_BITS > 0 ? 0 : BAM_BASE_TICKS))
+
+typedef enum shifted_pwm_mode {
+    // one interrupt per cycle, output switched off as each duty is reached
+    SHIFTED_PWM_MODE_PWM,
+    // one interrupt per timed bit plane with doubling delays
+    SHIFTED_PWM_MODE_BAM
+} shifted_pwm_mode;
+
+// isr counters and output readback, built by the host simulator in test/
+// and left out of the firmware, enable with CFLAGS += -DSHIFTED_PWM_STATS=1
+#ifndef SHIFTED_PWM_STATS
+#define SHIFTED_PWM_STATS 0
+#endif
+
+#if SHIFTED_PWM_STATS
+typedef struct shifted_pwm_stats {
+    uint32_t interrupts;
+    uint32_t transfers;
+    uint32_t periods;
+    // cpu cycles spent in the isr
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+} shifted_pwm_stats;
+#endif
+
+// how an input value of 0 to MAX_PWM_CYCLES becomes a duty
+typedef enum shifted_pwm_curve {
+    // duty proportional to the value
+    SHIFTED_PWM_CURVE_LINEAR,
+    // perceived brightness proportional to the value
+    SHIFTED_PWM_CURVE_GAMMA
+} shifted_pwm_curve;
+
+void shifted_pwm_init(shifted_pwm_mode mode);
 uint8_t get_pwm_value(uint8_t pin);
-void set_pwm_value(uint8_t pin, uint8_t value); 
+void set_pwm_value(uint8_t pin, uint8_t value);
+void set_pwm_value_curve(uint8_t pin, uint8_t value, shifted_pwm_curve curve);
+// value in 8.8 fixed point like stage_pwm_value_fine
+void set_pwm_value_fine(uint8_t pin, uint16_t value, shifted_pwm_curve curve);
+// staged values are only output after a commit, so several pins change at once
+void stage_pwm_value(uint8_t pin, uint8_t value);
+void stage_pwm_value_curve(uint8_t pin, uint8_t value, shifted_pwm_curve curve);
+// value in 8.8 fixed point, fractions are interpolated between table entries
+void stage_pwm_value_fine(uint8_t pin, uint16_t value, shifted_pwm_curve curve);
+void shifted_pwm_commit();
+// held around staging and the commit after it, so one task never commits
+// the values another is still staging, set_pwm_value takes it itself
+void shifted_pwm_lock_stage();
+void shifted_pwm_unlock_stage();
+// blocks until the last committed frame is being output, one frame per pwm period
+esp_err_t shifted_pwm_wait_frame(TickType_t timeout);
+
+#if SHIFTED_PWM_STATS
+void shifted_pwm_get_stats(shifted_pwm_stats *stats);
+void shifted_pwm_reset_stats();
+// on time of a pin in timer ticks (80MHz) per period of period_ticks, as currently output
+// in pwm mode the period is all of the dither steps together
+void shifted_pwm_output_duty(uint8_t pin, uint32_t *on_ticks, uint32_t *period_ticks);
+#endif
 
 #endif
\ No newline at end of file
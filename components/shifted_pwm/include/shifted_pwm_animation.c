@@ -0,0 +1,176 @@
+#include "shifted_pwm.h"
+#include "shifted_pwm_animation.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include "FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include <string.h>
+
+#define TAG "shifted-pwm-animation"
+
+// an idle engine still wakes up now and then in case a frame was missed
+#define FRAME_TIMEOUT_MS 50
+
+typedef struct animation {
+    bool active;
+    bool loop;
+    shifted_pwm_curve curve;
+    // 8.8 fixed point, where the current keyframe started from and where the channel is now
+    uint16_t from;
+    uint16_t value;
+    uint8_t current;
+    uint8_t total_keyframes;
+    // 0 until the first frame, so channels started together move together
+    int64_t segment_start;
+    shifted_pwm_keyframe keyframes[SHIFTED_PWM_MAX_KEYFRAMES];
+} animation;
+
+static animation animations[MAX_PWM_PINS];
+static int total_active = 0;
+static SemaphoreHandle_t animation_lock = NULL;
+static TaskHandle_t animation_task = NULL;
+
+static void shifted_pwm_animation_task(void *args);
+static bool shifted_pwm_animation_step(animation *channel, int64_t now);
+
+esp_err_t shifted_pwm_animation_init() {
+    animation_lock = xSemaphoreCreateMutex();
+    if (animation_lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (xTaskCreate(shifted_pwm_animation_task, "pwm-anim-task", 2048, NULL, 6, &animation_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start animation task");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t shifted_pwm_fade(uint8_t pin, uint8_t value, uint16_t duration_ms, shifted_pwm_curve curve) {
+    shifted_pwm_keyframe keyframe = {.value = value, .duration_ms = duration_ms};
+    return shifted_pwm_animate(pin, &keyframe, 1, false, curve);
+}
+
+esp_err_t shifted_pwm_animate(uint8_t pin, const shifted_pwm_keyframe *keyframes, int total_keyframes, bool loop, shifted_pwm_curve curve) {
+    if (pin >= MAX_PWM_PINS || total_keyframes < 1 || total_keyframes > SHIFTED_PWM_MAX_KEYFRAMES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (animation_lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // a loop that takes no time would never finish a frame
+    if (loop) {
+        uint32_t total_duration = 0;
+        for (int i = 0; i < total_keyframes; i++) {
+            total_duration += keyframes[i].duration_ms;
+        }
+        if (total_duration == 0) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    xSemaphoreTake(animation_lock, portMAX_DELAY);
+    animation *channel = &animations[pin];
+    // a running animation is retargeted from wherever it got to
+    if (!channel->active) {
+        channel->value = (uint16_t)get_pwm_value(pin) << 8;
+        total_active++;
+    }
+    channel->active = true;
+    channel->loop = loop;
+    channel->curve = curve;
+    channel->from = channel->value;
+    channel->current = 0;
+    channel->total_keyframes = total_keyframes;
+    channel->segment_start = 0;
+    memcpy(channel->keyframes, keyframes, total_keyframes * sizeof(shifted_pwm_keyframe));
+    // staging clamps as well, but a ramp past the top would sit there for the rest of its time
+    for (int i = 0; i < total_keyframes; i++) {
+        if (channel->keyframes[i].value > MAX_PWM_CYCLES) {
+            channel->keyframes[i].value = MAX_PWM_CYCLES;
+        }
+    }
+    xSemaphoreGive(animation_lock);
+
+    xTaskNotifyGive(animation_task);
+    return ESP_OK;
+}
+
+void shifted_pwm_stop(uint8_t pin) {
+    if (pin >= MAX_PWM_PINS || animation_lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(animation_lock, portMAX_DELAY);
+    if (animations[pin].active) {
+        animations[pin].active = false;
+        total_active--;
+    }
+    xSemaphoreGive(animation_lock);
+}
+
+void shifted_pwm_animation_task(void *args) {
+    while (1) {
+        // an animation started after this read has notified, so the take returns straight away
+        xSemaphoreTake(animation_lock, portMAX_DELAY);
+        int active = total_active;
+        xSemaphoreGive(animation_lock);
+        if (active == 0) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        int64_t now = esp_timer_get_time();
+        shifted_pwm_lock_stage();
+        xSemaphoreTake(animation_lock, portMAX_DELAY);
+        for (int pin = 0; pin < MAX_PWM_PINS; pin++) {
+            animation *channel = &animations[pin];
+            if (!channel->active) {
+                continue;
+            }
+            bool running = shifted_pwm_animation_step(channel, now);
+            stage_pwm_value_fine(pin, channel->value, channel->curve);
+            if (!running) {
+                channel->active = false;
+                total_active--;
+            }
+        }
+        xSemaphoreGive(animation_lock);
+
+        // the next step is computed while this frame is being shown
+        shifted_pwm_commit();
+        shifted_pwm_unlock_stage();
+        shifted_pwm_wait_frame(FRAME_TIMEOUT_MS / portTICK_PERIOD_MS);
+    }
+}
+
+bool shifted_pwm_animation_step(animation *channel, int64_t now) {
+    if (channel->segment_start == 0) {
+        channel->segment_start = now;
+    }
+
+    while (1) {
+        shifted_pwm_keyframe *keyframe = &channel->keyframes[channel->current];
+        uint16_t to = (uint16_t)keyframe->value << 8;
+        int64_t elapsed = now - channel->segment_start;
+        int64_t duration = (int64_t)keyframe->duration_ms * 1000;
+        if (elapsed < duration) {
+            channel->value = channel->from + ((int32_t)to - channel->from) * elapsed / duration;
+            return true;
+        }
+
+        // keyframe done, carry the overshoot into the next one so loops do not drift
+        channel->value = to;
+        channel->from = to;
+        channel->segment_start += duration;
+        channel->current++;
+        if (channel->current >= channel->total_keyframes) {
+            if (!channel->loop) {
+                return false;
+            }
+            channel->current = 0;
+        }
+    }
+}
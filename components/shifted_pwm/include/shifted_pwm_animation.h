@@ -0,0 +1,27 @@
+#ifndef __SHIFTED_PWM_ANIMATION_H__
+#define __SHIFTED_PWM_ANIMATION_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <esp_err.h>
+
+#include "shifted_pwm.h"
+
+#ifndef SHIFTED_PWM_MAX_KEYFRAMES
+#define SHIFTED_PWM_MAX_KEYFRAMES 8
+#endif
+
+// ramp from the previous value to value over duration_ms, values above MAX_PWM_CYCLES are clamped
+typedef struct shifted_pwm_keyframe {
+    uint8_t value;
+    uint16_t duration_ms;
+} shifted_pwm_keyframe;
+
+// channels are interpolated on the device once per pwm frame
+esp_err_t shifted_pwm_animation_init();
+esp_err_t shifted_pwm_fade(uint8_t pin, uint8_t value, uint16_t duration_ms, shifted_pwm_curve curve);
+esp_err_t shifted_pwm_animate(uint8_t pin, const shifted_pwm_keyframe *keyframes, int total_keyframes, bool loop, shifted_pwm_curve curve);
+// leaves the channel at its current value
+void shifted_pwm_stop(uint8_t pin);
+
+#endif
@@ -0,0 +1,125 @@
+// generated by gen_lut.py, do not edit
+#ifndef __SHIFTED_PWM_LUT_H__
+#define __SHIFTED_PWM_LUT_H__
+
+#include "shifted_pwm.h"
+
+// input value 0 to MAX_PWM_CYCLES mapped to a duty of 0 to PWM_DUTY_MAX
+#if SHIFTED_PWM_RESOLUTION_BITS == 8
+static const uint16_t pwm_linear_lut[MAX_PWM_CYCLES + 1] = {
+    0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30,
+    32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62,
+    64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94,
+    96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126,
+    128, 129, 131, 133, 135, 137, 139, 141, 143, 145, 147, 149, 151, 153, 155, 157,
+    159, 161, 163, 165, 167, 169, 171, 173, 175, 177, 179, 181, 183, 185, 187, 189,
+    191, 193, 195, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 233, 235, 237, 239, 241, 243, 245, 247, 249, 251, 253,
+    255,
+};
+static const uint16_t pwm_gamma_lut[MAX_PWM_CYCLES + 1] = {
+    0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+    4, 4, 4, 5, 5, 6, 6, 6, 7, 7, 8, 8, 9, 9, 10, 11,
+    11, 12, 13, 13, 14, 15, 16, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 30, 31, 32, 33, 35, 36, 38, 39, 41, 42, 44, 45,
+    47, 49, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 77,
+    79, 81, 84, 86, 89, 91, 94, 97, 99, 102, 105, 108, 111, 114, 117, 120,
+    123, 126, 130, 133, 136, 140, 143, 147, 150, 154, 158, 161, 165, 169, 173, 177,
+    181, 185, 189, 194, 198, 202, 207, 211, 216, 221, 225, 230, 235, 240, 245, 250,
+    255,
+};
+#elif SHIFTED_PWM_RESOLUTION_BITS == 9
+static const uint16_t pwm_linear_lut[MAX_PWM_CYCLES + 1] = {
+    0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60,
+    64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124,
+    128, 132, 136, 140, 144, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188,
+    192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 248, 252,
+    256, 259, 263, 267, 271, 275, 279, 283, 287, 291, 295, 299, 303, 307, 311, 315,
+    319, 323, 327, 331, 335, 339, 343, 347, 351, 355, 359, 363, 367, 371, 375, 379,
+    383, 387, 391, 395, 399, 403, 407, 411, 415, 419, 423, 427, 431, 435, 439, 443,
+    447, 451, 455, 459, 463, 467, 471, 475, 479, 483, 487, 491, 495, 499, 503, 507,
+    511,
+};
+static const uint16_t pwm_gamma_lut[MAX_PWM_CYCLES + 1] = {
+    0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 4, 5, 5, 6, 6, 7,
+    8, 8, 9, 10, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    23, 24, 25, 27, 28, 30, 31, 33, 35, 36, 38, 40, 42, 44, 46, 48,
+    50, 52, 55, 57, 59, 62, 64, 67, 70, 73, 75, 78, 81, 84, 88, 91,
+    94, 98, 101, 105, 108, 112, 116, 120, 123, 128, 132, 136, 140, 145, 149, 154,
+    158, 163, 168, 173, 178, 183, 188, 194, 199, 205, 211, 216, 222, 228, 234, 240,
+    247, 253, 260, 266, 273, 280, 287, 294, 301, 308, 316, 323, 331, 339, 347, 355,
+    363, 371, 380, 388, 397, 406, 415, 424, 433, 442, 452, 461, 471, 481, 491, 501,
+    511,
+};
+#elif SHIFTED_PWM_RESOLUTION_BITS == 10
+static const uint16_t pwm_linear_lut[MAX_PWM_CYCLES + 1] = {
+    0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120,
+    128, 136, 144, 152, 160, 168, 176, 184, 192, 200, 208, 216, 224, 232, 240, 248,
+    256, 264, 272, 280, 288, 296, 304, 312, 320, 328, 336, 344, 352, 360, 368, 376,
+    384, 392, 400, 408, 416, 424, 432, 440, 448, 456, 464, 472, 480, 488, 496, 504,
+    512, 519, 527, 535, 543, 551, 559, 567, 575, 583, 591, 599, 607, 615, 623, 631,
+    639, 647, 655, 663, 671, 679, 687, 695, 703, 711, 719, 727, 735, 743, 751, 759,
+    767, 775, 783, 791, 799, 807, 815, 823, 831, 839, 847, 855, 863, 871, 879, 887,
+    895, 903, 911, 919, 927, 935, 943, 951, 959, 967, 975, 983, 991, 999, 1007, 1015,
+    1023,
+};
+static const uint16_t pwm_gamma_lut[MAX_PWM_CYCLES + 1] = {
+    0, 1, 2, 3, 4, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 18, 19, 21, 22, 24, 26, 28, 29, 31, 33, 36, 38, 40, 43,
+    45, 48, 51, 53, 56, 59, 63, 66, 69, 73, 76, 80, 84, 88, 92, 96,
+    100, 105, 109, 114, 119, 124, 129, 134, 140, 145, 151, 157, 163, 169, 175, 182,
+    188, 195, 202, 209, 216, 224, 231, 239, 247, 255, 264, 272, 281, 289, 298, 308,
+    317, 327, 336, 346, 356, 367, 377, 388, 399, 410, 421, 433, 445, 457, 469, 481,
+    494, 507, 520, 533, 547, 560, 574, 588, 603, 617, 632, 647, 663, 678, 694, 710,
+    727, 743, 760, 777, 794, 812, 830, 848, 866, 885, 904, 923, 943, 962, 982, 1002,
+    1023,
+};
+#elif SHIFTED_PWM_RESOLUTION_BITS == 11
+static const uint16_t pwm_linear_lut[MAX_PWM_CYCLES + 1] = {
+    0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240,
+    256, 272, 288, 304, 320, 336, 352, 368, 384, 400, 416, 432, 448, 464, 480, 496,
+    512, 528, 544, 560, 576, 592, 608, 624, 640, 656, 672, 688, 704, 720, 736, 752,
+    768, 784, 800, 816, 832, 848, 864, 880, 896, 912, 928, 944, 960, 976, 992, 1008,
+    1024, 1039, 1055, 1071, 1087, 1103, 1119, 1135, 1151, 1167, 1183, 1199, 1215, 1231, 1247, 1263,
+    1279, 1295, 1311, 1327, 1343, 1359, 1375, 1391, 1407, 1423, 1439, 1455, 1471, 1487, 1503, 1519,
+    1535, 1551, 1567, 1583, 1599, 1615, 1631, 1647, 1663, 1679, 1695, 1711, 1727, 1743, 1759, 1775,
+    1791, 1807, 1823, 1839, 1855, 1871, 1887, 1903, 1919, 1935, 1951, 1967, 1983, 1999, 2015, 2031,
+    2047,
+};
+static const uint16_t pwm_gamma_lut[MAX_PWM_CYCLES + 1] = {
+    0, 2, 4, 5, 7, 9, 11, 12, 14, 16, 18, 20, 21, 23, 26, 28,
+    30, 33, 36, 38, 41, 45, 48, 51, 55, 59, 63, 67, 71, 76, 80, 85,
+    90, 96, 101, 107, 113, 119, 125, 132, 138, 145, 153, 160, 168, 176, 184, 192,
+    201, 210, 219, 228, 238, 248, 258, 269, 280, 291, 302, 314, 326, 338, 351, 364,
+    377, 391, 404, 419, 433, 448, 463, 479, 495, 511, 527, 544, 562, 579, 597, 616,
+    634, 654, 673, 693, 713, 734, 755, 776, 798, 821, 843, 866, 890, 914, 938, 963,
+    988, 1014, 1040, 1067, 1094, 1121, 1149, 1177, 1206, 1235, 1265, 1296, 1326, 1357, 1389, 1421,
+    1454, 1487, 1521, 1555, 1590, 1625, 1661, 1697, 1734, 1771, 1809, 1847, 1886, 1925, 1965, 2006,
+    2047,
+};
+#elif SHIFTED_PWM_RESOLUTION_BITS == 12
+static const uint16_t pwm_linear_lut[MAX_PWM_CYCLES + 1] = {
+    0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448, 480,
+    512, 544, 576, 608, 640, 672, 704, 736, 768, 800, 832, 864, 896, 928, 960, 992,
+    1024, 1056, 1088, 1120, 1152, 1184, 1216, 1248, 1280, 1312, 1344, 1376, 1408, 1440, 1472, 1504,
+    1536, 1568, 1600, 1632, 1664, 1696, 1728, 1760, 1792, 1824, 1856, 1888, 1920, 1952, 1984, 2016,
+    2048, 2079, 2111, 2143, 2175, 2207, 2239, 2271, 2303, 2335, 2367, 2399, 2431, 2463, 2495, 2527,
+    2559, 2591, 2623, 2655, 2687, 2719, 2751, 2783, 2815, 2847, 2879, 2911, 2943, 2975, 3007, 3039,
+    3071, 3103, 3135, 3167, 3199, 3231, 3263, 3295, 3327, 3359, 3391, 3423, 3455, 3487, 3519, 3551,
+    3583, 3615, 3647, 3679, 3711, 3743, 3775, 3807, 3839, 3871, 3903, 3935, 3967, 3999, 4031, 4063,
+    4095,
+};
+static const uint16_t pwm_gamma_lut[MAX_PWM_CYCLES + 1] = {
+    0, 4, 7, 11, 14, 18, 21, 25, 28, 32, 35, 39, 43, 47, 51, 56,
+    61, 66, 71, 77, 83, 89, 96, 103, 110, 118, 126, 134, 143, 152, 161, 171,
+    181, 191, 202, 214, 225, 238, 250, 263, 277, 291, 305, 320, 335, 351, 368, 384,
+    402, 420, 438, 457, 476, 496, 517, 538, 560, 582, 605, 628, 652, 677, 702, 728,
+    754, 781, 809, 837, 867, 896, 927, 958, 989, 1022, 1055, 1089, 1123, 1159, 1195, 1232,
+    1269, 1307, 1346, 1386, 1427, 1468, 1510, 1553, 1597, 1642, 1687, 1733, 1780, 1828, 1877, 1927,
+    1977, 2028, 2081, 2134, 2188, 2243, 2299, 2355, 2413, 2472, 2531, 2592, 2653, 2716, 2779, 2843,
+    2909, 2975, 3042, 3111, 3180, 3251, 3322, 3395, 3468, 3543, 3618, 3695, 3773, 3852, 3932, 4013,
+    4095,
+};
+#endif
+
+#endif
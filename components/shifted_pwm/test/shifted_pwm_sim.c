@@ -0,0 +1,493 @@
+// runs shifted_pwm.c on the host against a simulated spi bus and hw timer
+// every transfer is recorded with the time its bytes are latched, the duty each pin
+// is really output with is measured from that stream and checked against the curves
+// build and run with `make test`, see the Makefile for the configurations
+#include "shifted_pwm.h"
+#include "shifted_pwm_lut.h"
+
+#include "driver/spi.h"
+#include "driver/hw_timer.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if !SHIFTED_PWM_STATS
+#error "the simulator needs SHIFTED_PWM_STATS"
+#endif
+
+#define CPU_MHZ 160
+#define CCOUNT_PER_TICK (CPU_MHZ / 80)
+// spi at 20MHz is 4 timer ticks a bit, plus the driver setting up the transfer
+#define SPI_TICKS_PER_BIT 4
+#define SPI_SETUP_TICKS 120
+#define SPI_BURST_TICKS (8 * SHIFTED_PWM_REGISTERS * SPI_TICKS_PER_BIT + SPI_SETUP_TICKS)
+// cycles a read of the counter costs
+#define CCOUNT_READ_CYCLES 2
+// one transfer and the stats hooks, the gpio edge interrupts wait behind this
+#define MAX_ISR_CCOUNT ((uint64_t)SPI_BURST_TICKS * CCOUNT_PER_TICK + 4 * CCOUNT_READ_CYCLES)
+// freertos ticks
+#define TICK_MS 10
+
+#define MAX_TRANSFERS 4096
+#define MAX_PERIODS 32
+
+#define FRAME_LENGTH (MAX_PWM_CYCLES + 1)
+#define PWM_CYCLE_CCOUNT ((uint64_t)PWM_CYCLE_TICKS * CCOUNT_PER_TICK)
+#define BAM_BASE_CCOUNT ((uint64_t)BAM_BASE_TICKS * CCOUNT_PER_TICK)
+
+typedef struct transfer {
+    // ccount at which the registers latch, the end of the burst
+    uint64_t time;
+    uint8_t bytes[SHIFTED_PWM_REGISTERS];
+} transfer;
+
+// 64 bit so a run never wraps, the module only sees the low word
+static uint64_t now = 0;
+
+static hw_timer_callback_t timer_callback = NULL;
+static bool timer_enabled = false;
+static bool timer_reload = false;
+static uint32_t timer_load = 0;
+static uint64_t timer_fire = 0;
+
+static transfer transfers[MAX_TRANSFERS];
+static int total_transfers = 0;
+// index of the first transfer of every period
+static int period_first[MAX_PERIODS];
+static int total_periods = 0;
+
+static bool in_isr = false;
+static int isr_transfers = 0;
+static struct {
+    uint32_t interrupts;
+    uint32_t transfers;
+    uint32_t max_transfers;
+    uint32_t overruns;
+    uint64_t max_cycles;
+    uint64_t total_cycles;
+} isr_counts;
+
+static int main_task = 0;
+static bool notified = false;
+static int failures = 0;
+
+static shifted_pwm_mode mode;
+static const char *mode_name;
+// both modes only get every dither step right over this many periods
+static int check_periods = 1;
+
+#define CHECK(condition, ...) do { \
+    if (!(condition)) { \
+        printf("FAIL %s: ", mode_name); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+        failures++; \
+    } \
+} while (0)
+
+uint32_t read_ccount() {
+    now += CCOUNT_READ_CYCLES;
+    return (uint32_t)now;
+}
+
+esp_err_t spi_init(spi_host_t host, spi_config_t *config) {
+    return ESP_OK;
+}
+
+esp_err_t spi_trans(spi_host_t host, spi_trans_t *trans) {
+    CHECK(in_isr, "transfer outside the isr");
+    CHECK(trans->bits.mosi == 8 * SHIFTED_PWM_REGISTERS, "transfer of %u bits", trans->bits.mosi);
+    now += (uint64_t)(trans->bits.mosi * SPI_TICKS_PER_BIT + SPI_SETUP_TICKS) * CCOUNT_PER_TICK;
+    if (total_transfers >= MAX_TRANSFERS) {
+        CHECK(false, "transfer log full");
+        return ESP_FAIL;
+    }
+    transfer *recorded = &transfers[total_transfers++];
+    recorded->time = now;
+    memcpy(recorded->bytes, trans->mosi, SHIFTED_PWM_REGISTERS);
+    isr_transfers++;
+    return ESP_OK;
+}
+
+esp_err_t hw_timer_init(hw_timer_callback_t callback, void *arg) {
+    timer_callback = callback;
+    return ESP_OK;
+}
+
+esp_err_t hw_timer_set_clkdiv(hw_timer_clkdiv_t clkdiv) {
+    CHECK(clkdiv == TIMER_CLKDIV_1, "timer divider %d", clkdiv);
+    return ESP_OK;
+}
+
+esp_err_t hw_timer_set_intr_type(hw_timer_intr_type_t intr_type) {
+    return ESP_OK;
+}
+
+esp_err_t hw_timer_set_reload(bool reload) {
+    timer_reload = reload;
+    return ESP_OK;
+}
+
+esp_err_t hw_timer_set_load_data(uint32_t load_data) {
+    CHECK(load_data >= BAM_MIN_TIMER_TICKS && load_data < (1u << 23), "timer load %u", load_data);
+    timer_load = load_data;
+    timer_fire = now + (uint64_t)load_data * CCOUNT_PER_TICK;
+    return ESP_OK;
+}
+
+esp_err_t hw_timer_enable(bool en) {
+    timer_enabled = en;
+    timer_fire = now + (uint64_t)timer_load * CCOUNT_PER_TICK;
+    return ESP_OK;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return &main_task;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t timeout) {
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return pdTRUE;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return &main_task;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken) {
+    CHECK(in_isr, "notified outside the isr");
+    notified = true;
+    *woken = pdTRUE;
+}
+
+static void fire() {
+    CHECK(timer_enabled && timer_callback != NULL, "timer never started");
+    if (timer_fire > now) {
+        now = timer_fire;
+    }
+    uint64_t start = now;
+    if (timer_reload) {
+        timer_fire += (uint64_t)timer_load * CCOUNT_PER_TICK;
+    }
+
+    shifted_pwm_stats before, after;
+    shifted_pwm_get_stats(&before);
+    int first = total_transfers;
+    in_isr = true;
+    isr_transfers = 0;
+    timer_callback(NULL);
+    in_isr = false;
+    shifted_pwm_get_stats(&after);
+
+    if (after.periods != before.periods && total_periods < MAX_PERIODS) {
+        period_first[total_periods++] = first;
+    }
+    uint64_t cycles = now - start;
+    isr_counts.interrupts++;
+    isr_counts.transfers += isr_transfers;
+    isr_counts.total_cycles += cycles;
+    if (cycles > isr_counts.max_cycles) {
+        isr_counts.max_cycles = cycles;
+    }
+    if (isr_transfers > isr_counts.max_transfers) {
+        isr_counts.max_transfers = isr_transfers;
+    }
+    // the next interrupt would have come in while this one was still running
+    if (now > timer_fire) {
+        isr_counts.overruns++;
+    }
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t timeout) {
+    uint64_t deadline = now + (uint64_t)timeout * TICK_MS * 1000 * CPU_MHZ;
+    while (!notified && timer_fire <= deadline) {
+        fire();
+    }
+    uint32_t result = notified;
+    notified = false;
+    return result;
+}
+
+static void reset_log() {
+    total_transfers = 0;
+    total_periods = 0;
+}
+
+// stops right after the interrupt that starts the n-th next period
+static void run_periods(int periods) {
+    int target = total_periods + periods;
+    // no period has more interrupts than pwm cycles
+    for (int limit = (periods + 1) * FRAME_LENGTH; total_periods < target && limit > 0; limit--) {
+        fire();
+    }
+}
+
+static uint16_t curve_duty(uint16_t value, shifted_pwm_curve curve) {
+    const uint16_t *lut = (curve == SHIFTED_PWM_CURVE_GAMMA) ? pwm_gamma_lut : pwm_linear_lut;
+    uint8_t whole = value >> 8;
+    uint8_t fraction = value & 0xFF;
+    if (whole >= MAX_PWM_CYCLES) {
+        return lut[MAX_PWM_CYCLES];
+    }
+    return lut[whole] + (((uint32_t)(lut[whole + 1] - lut[whole]) * fraction + 0x80) >> 8);
+}
+
+// cycles a duty is on for over all dither steps, whole cycles count once per step
+static uint32_t pwm_steps(uint16_t duty) {
+    return ((uint32_t)duty * FRAME_LENGTH * PWM_DITHER_STEPS + PWM_DUTY_MAX / 2) / PWM_DUTY_MAX;
+}
+
+// cycles a duty is on for from the start of every period, the last one is dithered
+static int pwm_cycles(uint16_t duty) {
+    int cycles = pwm_steps(duty) / PWM_DITHER_STEPS;
+    return cycles < MAX_PWM_CYCLES ? cycles : MAX_PWM_CYCLES;
+}
+
+// base planes a duty is on for per period, averaged over the dither steps
+static uint32_t bam_duty(uint16_t duty) {
+    // a full duty is on through the dither plane every period, which is one base plane longer
+    return BAM_DITHER_BITS > 0 && duty == PWM_DUTY_MAX ? PWM_DUTY_MAX + 1 : duty;
+}
+
+// largest duty error in lsb a mode may show, the mean has to stay under two thirds of it
+// rounding alone averages half the largest error, a bias on top of that shows up as more
+// pwm rounds to the nearest dither step, bam runs every plane over by the time it takes
+// to latch and shows a full duty for one base plane more
+static double max_duty_error() {
+    if (mode == SHIFTED_PWM_MODE_PWM) {
+        return (double)PWM_DUTY_MAX / (FRAME_LENGTH * PWM_DITHER_STEPS) / 2;
+    }
+    int period_transfers = (BAM_DITHER_BITS > 0) + BAM_PLANES - BAM_DITHER_BITS;
+    double overrun = (double)period_transfers * (SPI_BURST_TICKS + 4 * CCOUNT_READ_CYCLES / CCOUNT_PER_TICK) / BAM_PERIOD_TICKS;
+    return overrun * PWM_DUTY_MAX + (BAM_DITHER_BITS > 0 ? 1 : 0);
+}
+
+static bool pin_bit(const uint8_t *bytes, int pin) {
+    return bytes[SHIFTED_PWM_REGISTERS - 1 - pin / 8] & (1u << (pin % 8));
+}
+
+// compares the recorded stream of check_periods periods against the duties they should show
+static void check_period(int period, const uint16_t *duties, const char *name) {
+    if (period + check_periods >= total_periods) {
+        CHECK(false, "%s: period %d never ended", name, period + check_periods - 1);
+        return;
+    }
+    int first = period_first[period];
+    int last = period_first[period + check_periods];
+    uint64_t start = transfers[first].time;
+    uint64_t length = transfers[last].time - start;
+
+    uint64_t on[MAX_PWM_PINS] = {0};
+    for (int i = first; i < last; i++) {
+        uint64_t shown = transfers[i + 1].time - transfers[i].time;
+        for (int pin = 0; pin < MAX_PWM_PINS; pin++) {
+            if (pin_bit(transfers[i].bytes, pin)) {
+                on[pin] += shown;
+            }
+        }
+    }
+
+    // what was shifted out, cycle by cycle or plane by plane
+    if (mode == SHIFTED_PWM_MODE_PWM) {
+        CHECK(length == check_periods * FRAME_LENGTH * PWM_CYCLE_CCOUNT, "%s: %d periods of %llu cycles", name,
+                check_periods, (unsigned long long)length);
+        // a cycle is only sent when some pin switches off at its start, the dithered last one always
+        bool switches[FRAME_LENGTH] = {true};
+        switches[MAX_PWM_CYCLES] = true;
+        for (int pin = 0; pin < MAX_PWM_PINS; pin++) {
+            switches[pwm_cycles(duties[pin])] = true;
+        }
+        int expected_transfers = 0;
+        for (int cycle = 0; cycle < FRAME_LENGTH; cycle++) {
+            expected_transfers += switches[cycle];
+        }
+        CHECK(last - first == check_periods * expected_transfers, "%s: %d transfers for %d periods, expected %d each", name,
+                last - first, check_periods, expected_transfers);
+        for (int i = first; i < last; i++) {
+            int cycle = (transfers[i].time - start) / PWM_CYCLE_CCOUNT % FRAME_LENGTH;
+            if (cycle == MAX_PWM_CYCLES) {
+                continue;
+            }
+            for (int pin = 0; pin < MAX_PWM_PINS; pin++) {
+                bool expected = cycle < pwm_cycles(duties[pin]);
+                CHECK(pin_bit(transfers[i].bytes, pin) == expected, "%s: pin %d is %d in cycle %d", name, pin, !expected, cycle);
+            }
+        }
+    } else {
+        // the dither step comes first in every period, then the timed planes
+        int dither = BAM_DITHER_BITS > 0;
+        int period_transfers = dither + BAM_PLANES - BAM_DITHER_BITS;
+        CHECK(last - first == check_periods * period_transfers, "%s: %d transfers for %d periods of %d planes", name,
+                last - first, check_periods, period_transfers);
+        for (int i = period; i < period + check_periods; i++) {
+            int start = period_first[i];
+            for (int plane = BAM_DITHER_BITS; plane < BAM_PLANES && start + dither + plane - BAM_DITHER_BITS < last; plane++) {
+                const uint8_t *bytes = transfers[start + dither + plane - BAM_DITHER_BITS].bytes;
+                for (int pin = 0; pin < MAX_PWM_PINS; pin++) {
+                    bool expected = (duties[pin] >> plane) & 1u;
+                    CHECK(pin_bit(bytes, pin) == expected, "%s: pin %d is %d in plane %d", name, pin, !expected, plane);
+                }
+            }
+        }
+    }
+
+    // and how long every pin was really on for
+    double worst = 0;
+    double total_error = 0;
+    for (int pin = 0; pin < MAX_PWM_PINS; pin++) {
+        uint64_t expected_on;
+        // every plane runs over by the time from the interrupt that ends it to the latch
+        uint64_t tolerance;
+        if (mode == SHIFTED_PWM_MODE_PWM) {
+            expected_on = pwm_steps(duties[pin]) * PWM_CYCLE_CCOUNT;
+            tolerance = 0;
+        } else {
+            expected_on = bam_duty(duties[pin]) * BAM_BASE_CCOUNT * check_periods;
+            tolerance = (uint64_t)(last - first) * (SPI_BURST_TICKS * CCOUNT_PER_TICK + 4 * CCOUNT_READ_CYCLES);
+        }
+        uint64_t error = on[pin] > expected_on ? on[pin] - expected_on : expected_on - on[pin];
+        CHECK(error <= tolerance, "%s: pin %d on for %llu cycles, expected %llu", name, pin,
+                (unsigned long long)on[pin], (unsigned long long)expected_on);
+        double duty_error = (double)on[pin] / length - (double)duties[pin] / PWM_DUTY_MAX;
+        if (duty_error < 0) {
+            duty_error = -duty_error;
+        }
+        if (duty_error > worst) {
+            worst = duty_error;
+        }
+        total_error += duty_error;
+    }
+    double mean = total_error / MAX_PWM_PINS;
+    // a little slack for rounding the doubles, not for the output
+    double bound = max_duty_error() + 1e-6;
+    CHECK(worst * PWM_DUTY_MAX <= bound, "%s: worst duty error %.3f lsb, at most %.3f", name, worst * PWM_DUTY_MAX, bound);
+    CHECK(mean * PWM_DUTY_MAX <= bound * 2 / 3, "%s: mean duty error %.3f lsb, at most %.3f", name, mean * PWM_DUTY_MAX,
+            bound * 2 / 3);
+    printf("%s %s: period %.3fms, duty error worst %.2f mean %.2f lsb, bound %.2f\n", mode_name, name,
+            length / (CPU_MHZ * 1000.0) / check_periods, worst * PWM_DUTY_MAX, mean * PWM_DUTY_MAX, bound);
+}
+
+// the readback decodes the active frame, it should agree with the stream
+static void check_readback(const uint16_t *duties, const char *name) {
+    for (int pin = 0; pin < MAX_PWM_PINS; pin++) {
+        uint32_t on_ticks, period_ticks;
+        shifted_pwm_output_duty(pin, &on_ticks, &period_ticks);
+        if (mode == SHIFTED_PWM_MODE_PWM) {
+            CHECK(on_ticks == pwm_steps(duties[pin]) * PWM_CYCLE_TICKS &&
+                    period_ticks == FRAME_LENGTH * PWM_CYCLE_TICKS * PWM_DITHER_STEPS,
+                    "%s: pin %d reads back %u/%u", name, pin, on_ticks, period_ticks);
+        } else {
+            CHECK(on_ticks == bam_duty(duties[pin]) * BAM_BASE_TICKS && period_ticks == BAM_PERIOD_TICKS,
+                    "%s: pin %d reads back %u/%u", name, pin, on_ticks, period_ticks);
+        }
+    }
+}
+
+// commits, waits for the frame to come out and runs it to the end, returns its period
+static int show() {
+    reset_log();
+    shifted_pwm_commit();
+    CHECK(shifted_pwm_wait_frame(1000 / TICK_MS) == ESP_OK, "frame never swapped in");
+    int period = total_periods - 1;
+    run_periods(check_periods);
+    return period;
+}
+
+static void stage_all(const uint16_t *values, shifted_pwm_curve curve, uint16_t *duties) {
+    for (int pin = 0; pin < MAX_PWM_PINS; pin++) {
+        stage_pwm_value_fine(pin, values[pin], curve);
+        duties[pin] = curve_duty(values[pin], curve);
+    }
+}
+
+static void run_mode(shifted_pwm_mode run_mode, const char *name) {
+    mode = run_mode;
+    mode_name = name;
+    check_periods = mode == SHIFTED_PWM_MODE_BAM ? BAM_DITHER_STEPS : PWM_DITHER_STEPS;
+    memset(&isr_counts, 0, sizeof(isr_counts));
+    shifted_pwm_init(mode);
+    shifted_pwm_reset_stats();
+
+    uint16_t values[MAX_PWM_PINS];
+    uint16_t duties[MAX_PWM_PINS];
+    uint16_t previous[MAX_PWM_PINS];
+
+    // the ends of the range and a spread of whole values in between
+    for (int pin = 0; pin < MAX_PWM_PINS; pin++) {
+        values[pin] = ((pin * 37 + 5) % (MAX_PWM_CYCLES + 1)) << 8;
+    }
+    values[0] = 0;
+    values[MAX_PWM_PINS - 1] = MAX_PWM_CYCLES << 8;
+    stage_all(values, SHIFTED_PWM_CURVE_LINEAR, duties);
+    check_period(show(), duties, "linear");
+    check_readback(duties, "linear");
+
+    stage_all(values, SHIFTED_PWM_CURVE_GAMMA, duties);
+    check_period(show(), duties, "gamma");
+    check_readback(duties, "gamma");
+
+    // a notification left over from an earlier frame does not end the next wait
+    notified = true;
+    reset_log();
+    shifted_pwm_commit();
+    CHECK(shifted_pwm_wait_frame(1000 / TICK_MS) == ESP_OK, "frame never swapped in");
+    CHECK(total_periods == 1, "wait returned after %d periods, before the frame was swapped in", total_periods);
+
+    for (int pin = 0; pin < MAX_PWM_PINS; pin++) {
+        values[pin] = (pin * 4099 + 77) % (MAX_PWM_CYCLES << 8);
+    }
+    stage_all(values, SHIFTED_PWM_CURVE_GAMMA, duties);
+    check_period(show(), duties, "fine");
+
+    // a commit halfway through a period only shows from the next one
+    memcpy(previous, duties, sizeof(previous));
+    reset_log();
+    run_periods(check_periods);
+    int interrupts = isr_counts.interrupts;
+    while (isr_counts.interrupts - interrupts < (mode == SHIFTED_PWM_MODE_PWM ? FRAME_LENGTH / 2 : BAM_PLANES / 2)) {
+        fire();
+    }
+    for (int pin = 0; pin < MAX_PWM_PINS; pin++) {
+        values[pin] = (MAX_PWM_CYCLES - pin) << 8;
+    }
+    stage_all(values, SHIFTED_PWM_CURVE_LINEAR, duties);
+    shifted_pwm_commit();
+    CHECK(shifted_pwm_wait_frame(1000 / TICK_MS) == ESP_OK, "frame never swapped in");
+    CHECK(total_periods == check_periods + 1, "commit took %d periods", total_periods - check_periods);
+    run_periods(check_periods);
+    check_period(0, previous, "before commit");
+    check_period(check_periods, duties, "after commit");
+
+    // the isr against the counters the module keeps itself
+    shifted_pwm_stats stats;
+    shifted_pwm_get_stats(&stats);
+    CHECK(stats.interrupts == isr_counts.interrupts, "module counted %u interrupts of %u", stats.interrupts, isr_counts.interrupts);
+    CHECK(stats.transfers == isr_counts.transfers, "module counted %u transfers of %u", stats.transfers, isr_counts.transfers);
+    CHECK(stats.max_cycles <= isr_counts.max_cycles, "module measured %u cycles, more than %llu", stats.max_cycles,
+            (unsigned long long)isr_counts.max_cycles);
+    CHECK(isr_counts.overruns == 0, "%u interrupts overran the next one", isr_counts.overruns);
+    CHECK(isr_counts.max_transfers <= 1, "%u transfers in one interrupt", isr_counts.max_transfers);
+    CHECK(isr_counts.max_cycles <= MAX_ISR_CCOUNT, "isr ran for %.1fus, at most %.1fus", (double)isr_counts.max_cycles / CPU_MHZ,
+            (double)MAX_ISR_CCOUNT / CPU_MHZ);
+    printf("%s isr: %u interrupts, %.2f transfers each, avg %.1fus max %.1fus\n", mode_name,
+            isr_counts.interrupts, (double)isr_counts.transfers / isr_counts.interrupts,
+            (double)isr_counts.total_cycles / isr_counts.interrupts / CPU_MHZ, (double)isr_counts.max_cycles / CPU_MHZ);
+}
+
+int main() {
+    printf("%d registers, %d bits, pwm %d dither bits, bam base %d ticks, %d dither bits\n", SHIFTED_PWM_REGISTERS,
+            SHIFTED_PWM_RESOLUTION_BITS, PWM_DITHER_BITS, BAM_BASE_TICKS, BAM_DITHER_BITS);
+    run_mode(SHIFTED_PWM_MODE_PWM, "pwm");
+    run_mode(SHIFTED_PWM_MODE_BAM, "bam");
+    if (failures) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
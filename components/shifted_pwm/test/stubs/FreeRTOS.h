@@ -0,0 +1,15 @@
+#ifndef __FREERTOS_H__
+#define __FREERTOS_H__
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef void *TaskHandle_t;
+typedef void *SemaphoreHandle_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define portMAX_DELAY ((TickType_t)0xffffffff)
+
+#endif
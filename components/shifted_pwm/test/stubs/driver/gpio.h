@@ -0,0 +1,4 @@
+#ifndef __GPIO_H__
+#define __GPIO_H__
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef __HW_TIMER_H__
+#define __HW_TIMER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef void (*hw_timer_callback_t)(void *arg);
+
+typedef enum {
+    TIMER_CLKDIV_1 = 0,
+    TIMER_CLKDIV_16 = 4,
+    TIMER_CLKDIV_256 = 8
+} hw_timer_clkdiv_t;
+
+typedef enum {
+    TIMER_EDGE_INT = 0,
+    TIMER_LEVEL_INT = 1
+} hw_timer_intr_type_t;
+
+esp_err_t hw_timer_init(hw_timer_callback_t callback, void *arg);
+esp_err_t hw_timer_set_clkdiv(hw_timer_clkdiv_t clkdiv);
+esp_err_t hw_timer_set_intr_type(hw_timer_intr_type_t intr_type);
+esp_err_t hw_timer_set_reload(bool reload);
+// loading restarts the count, as on the esp8266
+esp_err_t hw_timer_set_load_data(uint32_t load_data);
+esp_err_t hw_timer_enable(bool en);
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef __SPI_H__
+#define __SPI_H__
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef enum {
+    CSPI_HOST = 0,
+    HSPI_HOST
+} spi_host_t;
+
+typedef enum {
+    SPI_MASTER_MODE,
+    SPI_SLAVE_MODE
+} spi_mode_t;
+
+#define SPI_20MHz_DIV 4
+#define SPI_DEFAULT_INTERFACE 0x1F0
+#define SPI_MASTER_DEFAULT_INTR_ENABLE 0x10
+
+typedef struct {
+    union {
+        struct {
+            uint32_t cpol: 1;
+            uint32_t cpha: 1;
+            uint32_t bit_tx_order: 1;
+            uint32_t bit_rx_order: 1;
+            uint32_t byte_tx_order: 1;
+            uint32_t byte_rx_order: 1;
+            uint32_t mosi_en: 1;
+            uint32_t miso_en: 1;
+            uint32_t cs_en: 1;
+        };
+        uint32_t val;
+    } interface;
+    union {
+        uint32_t val;
+    } intr_enable;
+    void (*event_cb)(int event, void *arg);
+    spi_mode_t mode;
+    uint32_t clk_div;
+} spi_config_t;
+
+typedef struct {
+    uint16_t *cmd;
+    uint32_t *addr;
+    uint32_t *mosi;
+    uint32_t *miso;
+    struct {
+        uint32_t cmd;
+        uint32_t addr;
+        uint32_t mosi;
+        uint32_t miso;
+    } bits;
+} spi_trans_t;
+
+esp_err_t spi_init(spi_host_t host, spi_config_t *config);
+// records the bytes and advances the cycle counter by the burst
+esp_err_t spi_trans(spi_host_t host, spi_trans_t *trans);
+
+#endif
@@ -0,0 +1,11 @@
+// host stand-ins for the sdk headers shifted_pwm.c includes, see ../shifted_pwm_sim.c
+#ifndef __ESP_ERR_H__
+#define __ESP_ERR_H__
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_TIMEOUT 0x107
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef __PORTMACRO_H__
+#define __PORTMACRO_H__
+
+// the simulator runs the isr and the tasks on one thread
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
+#define portYIELD_FROM_ISR()
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef __SEMPHR_H__
+#define __SEMPHR_H__
+
+#include "FreeRTOS.h"
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t timeout);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+#endif
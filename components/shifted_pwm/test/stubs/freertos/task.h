@@ -0,0 +1,11 @@
+#ifndef __TASK_H__
+#define __TASK_H__
+
+#include "FreeRTOS.h"
+
+TaskHandle_t xTaskGetCurrentTaskHandle();
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken);
+// runs the timer until the isr gives a notification or the timeout passes
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t timeout);
+
+#endif
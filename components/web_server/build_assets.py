@@ -0,0 +1,135 @@
+#!/usr/bin/env python
+# Compresses the web ui in www/ into an image for the www data partition
+# Flash it with `make www-flash`, the firmware does not need to be rebuilt
+import argparse
+import gzip
+import hashlib
+import io
+import os
+import struct
+
+COMPONENT_DIR = os.path.dirname(os.path.abspath(__file__))
+WWW_DIR = os.path.join(COMPONENT_DIR, "www")
+OUTPUT_PATH = "www.bin"
+
+# (uri, file in www/, content type, fingerprinted)
+# fingerprinted assets get the content hash in their uri and are cached forever
+# pages are revalidated with their etag and have fingerprinted references rewritten
+ASSETS = [
+    ("/", "index.html", "text/html", False),
+    ("/main.js", "main.js", "application/javascript", True),
+    ("/chunk.js", "chunk.js", "application/javascript", True),
+]
+
+# must match assets.h
+ENCODING_IDENTITY = 0
+ENCODING_GZIP = 1
+ENCODING_NAMES = {ENCODING_IDENTITY: "identity", ENCODING_GZIP: "gzip"}
+
+MAGIC = 0x31415757  # "WWA1"
+MAX_ASSETS = 8
+HEADER = struct.Struct("<III")
+ENTRY = struct.Struct("<48s32s48s48sB3xII")
+PARTITION_SIZE = 0x40000
+
+CACHE_IMMUTABLE = "public, max-age=31536000, immutable"
+CACHE_REVALIDATE = "no-cache"
+
+
+def compress(data):
+    # fixed mtime so the output only changes when the ui does
+    buffer = io.BytesIO()
+    with gzip.GzipFile(fileobj=buffer, mode="wb", compresslevel=9, mtime=0) as file:
+        file.write(data)
+    return buffer.getvalue()
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def fingerprint_uri(uri, digest):
+    root, extension = os.path.splitext(uri)
+    return "%s.%s%s" % (root, digest[:8], extension)
+
+
+def pack_string(value, size):
+    data = value.encode()
+    if len(data) >= size:
+        raise ValueError("'%s' does not fit in %d bytes" % (value, size))
+    return data
+
+
+def align(offset):
+    # keeps every flash read word aligned
+    return (offset + 3) & ~3
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compress the web ui into a www partition image")
+    parser.add_argument("--gzip-only", action="store_true",
+                        help="leave out the uncompressed copies, clients without gzip then get 406")
+    parser.add_argument("--output", default=OUTPUT_PATH)
+    args = parser.parse_args()
+
+    contents = {}
+    renamed = {}
+    for uri, filename, content_type, fingerprinted in ASSETS:
+        with open(os.path.join(WWW_DIR, filename), "rb") as file:
+            contents[uri] = file.read()
+        if fingerprinted:
+            renamed[uri] = fingerprint_uri(uri, content_hash(contents[uri]))
+
+    # point pages at the fingerprinted names
+    for uri, filename, content_type, fingerprinted in ASSETS:
+        if content_type == "text/html":
+            for old_uri, new_uri in renamed.items():
+                contents[uri] = contents[uri].replace(('"%s"' % old_uri).encode(), ('"%s"' % new_uri).encode())
+
+    representations = []
+    total_raw = 0
+    for uri, filename, content_type, fingerprinted in ASSETS:
+        raw = contents[uri]
+        served_uri = renamed.get(uri, uri)
+        cache_control = CACHE_IMMUTABLE if fingerprinted else CACHE_REVALIDATE
+        # identity as well by default, so clients like plain curl still get the ui
+        variants = [(ENCODING_GZIP, compress(raw))]
+        if not args.gzip_only:
+            variants.append((ENCODING_IDENTITY, raw))
+
+        total_raw += len(raw)
+        for encoding, data in variants:
+            # each encoding is a separate representation, so the etag covers
+            # the stored bytes and names the encoding, a gzip etag never matches identity
+            etag = '"%s-%s"' % (content_hash(data), ENCODING_NAMES[encoding])
+            representations.append((served_uri, content_type, encoding, etag, cache_control, data))
+        print("%-24s %7d -> %7d bytes" % (served_uri, len(raw), len(variants[0][1])))
+
+    if len(representations) > MAX_ASSETS:
+        raise ValueError("%d assets, the firmware holds at most %d" % (len(representations), MAX_ASSETS))
+
+    # header, then the fixed size manifest, then the data of every asset
+    entries = []
+    blobs = []
+    offset = align(HEADER.size + ENTRY.size * len(representations))
+    for uri, content_type, encoding, etag, cache_control, data in representations:
+        entries.append(ENTRY.pack(pack_string(uri, 48), pack_string(content_type, 32), pack_string(etag, 48),
+                                  pack_string(cache_control, 48), encoding, offset, len(data)))
+        blobs.append((offset, data))
+        offset = align(offset + len(data))
+
+    image = bytearray(offset)
+    image[0:HEADER.size] = HEADER.pack(MAGIC, len(entries), offset)
+    image[HEADER.size:HEADER.size + ENTRY.size * len(entries)] = b"".join(entries)
+    for start, data in blobs:
+        image[start:start + len(data)] = data
+    if len(image) > PARTITION_SIZE:
+        raise ValueError("image is %d bytes, the www partition holds %d" % (len(image), PARTITION_SIZE))
+
+    print("%-24s %7d -> %7d bytes" % ("total", total_raw, len(image)))
+    with open(args.output, "wb") as file:
+        file.write(image)
+
+
+if __name__ == "__main__":
+    main()
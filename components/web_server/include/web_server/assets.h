@@ -0,0 +1,36 @@
+#ifndef __WEBSERVER_ASSETS_H__
+#define __WEBSERVER_ASSETS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+// the web ui lives in its own data partition, written by build_assets.py
+#define WEB_ASSETS_PARTITION_LABEL "www"
+#define WEB_ASSETS_PARTITION_SUBTYPE 0x40
+#define WEB_ASSETS_MAGIC 0x31415757
+#define WEB_ASSETS_MAX 8
+
+#define WEB_ASSET_IDENTITY 0
+#define WEB_ASSET_GZIP 1
+
+// start of the partition, followed by count manifest entries
+typedef struct web_assets_header {
+    uint32_t magic;
+    uint32_t count;
+    uint32_t length;
+} web_assets_header;
+
+// manifest entry, layout must match ENTRY in build_assets.py
+typedef struct web_asset {
+    char uri[48];
+    char content_type[32];
+    char etag[48];
+    char cache_control[48];
+    // WEB_ASSET_IDENTITY or WEB_ASSET_GZIP, an uri is listed once per encoding
+    uint8_t encoding;
+    // relative to the start of the partition
+    uint32_t offset;
+    uint32_t length;
+} web_asset;
+
+#endif
@@ -1,9 +0,0 @@
-#ifndef __WEBSERBER_FILES_H__
-#define __WEBSERBER_FILES_H__
-
-const char index_js_file[] = "<!doctype html><html lang=\"en\"><head><meta charset=\"utf-8\"/><meta name=\"viewport\" content=\"width=device-width,initial-scale=1\"/><meta name=\"theme-color\" content=\"#000000\"/><script src=\"https://kit.fontawesome.com/e69b5553f2.js\" crossorigin=\"anonymous\"></script><script src=\"https://code.jquery.com/jquery-3.4.1.slim.min.js\" integrity=\"sha384-J6qa4849blE2+poT4WnyKhv5vZF5SrPo0iEjwBvKU7imGFAV0wwj1yYfoRSJoZ+n\" crossorigin=\"anonymous\"></script><script src=\"https://cdn.jsdelivr.net/npm/popper.js@1.16.0/dist/umd/popper.min.js\" integrity=\"sha384-Q6E9RHvbIyZFJoft+2mJbHaEWldlvI9IOYy5n3zV9zzTtmI3UksdQRVvoxMfooAo\" crossorigin=\"anonymous\"></script><link rel=\"stylesheet\" href=\"https://stackpath.bootstrapcdn.com/bootstrap/4.4.1/css/bootstrap.min.css\" integrity=\"sha384-Vkoo8x4CGsO3+Hhxv8T/Q5PaXtkKtu6ug5TOeNV6gBiFeWPGFN9MuhOf23Q9Ifjh\" crossorigin=\"anonymous\"><script src=\"https://stackpath.bootstrapcdn.com/bootstrap/4.4.1/js/bootstrap.min.js\" integrity=\"sha384-wfSDF2E50Y2D1uUdj0O3uMBJnjuUD4Ih7YwaYd1iqfktj0Uod8GCExl3Og8ifwB6\" crossorigin=\"anonymous\"></script><title>React App</title></head><body><noscript>You need to enable JavaScript to run this app.</noscript><div id=\"root\"></div><script>!function(e){function t(t){for(var n,l,i=t[0],f=t[1],a=t[2],p=0,s=[];p<i.length;p++)l=i[p],Object.prototype.hasOwnProperty.call(o,l)&&o[l]&&s.push(o[l][0]),o[l]=0;for(n in f)Object.prototype.hasOwnProperty.call(f,n)&&(e[n]=f[n]);for(c&&c(t);s.length;)s.shift()();return u.push.apply(u,a||[]),r()}function r(){for(var e,t=0;t<u.length;t++){for(var r=u[t],n=!0,i=1;i<r.length;i++){var f=r[i];0!==o[f]&&(n=!1)}n&&(u.splice(t--,1),e=l(l.s=r[0]))}return e}var n={},o={1:0},u=[];function l(t){if(n[t])return n[t].exports;var r=n[t]={i:t,l:!1,exports:{}};return e[t].call(r.exports,r,r.exports,l),r.l=!0,r.exports}l.m=e,l.c=n,l.d=function(e,t,r){l.o(e,t)||Object.defineProperty(e,t,{enumerable:!0,get:r})},l.r=function(e){\"undefined\"!=typeof Symbol&&Symbol.toStringTag&&Object.defineProperty(e,Symbol.toStringTag,{value:\"Module\"}),Object.defineProperty(e,\"__esModule\",{value:!0})},l.t=function(e,t){if(1&t&&(e=l(e)),8&t)return e;if(4&t&&\"object\"==typeof e&&e&&e.__esModule)return e;var r=Object.create(null);if(l.r(r),Object.defineProperty(r,\"default\",{enumerable:!0,value:e}),2&t&&\"string\"!=typeof e)for(var n in e)l.d(r,n,function(t){return e[t]}.bind(null,n));return r},l.n=function(e){var t=e&&e.__esModule?function(){return e.default}:function(){return e};return l.d(t,\"a\",t),t},l.o=function(e,t){return Object.prototype.hasOwnProperty.call(e,t)},l.p=\"/\";var i=this[\"webpackJsonpws-client\"]=this[\"webpackJsonpws-client\"]||[],f=i.push.bind(i);i.push=t,i=i.slice();for(var a=0;a<i.length;a++)t(i[a]);var c=f;r()}([])</script><script src=\"/chunk.js\"></script><script src=\"/main.js\"></script></body></html>";
-const char main_js_file[] = "(this[\"webpackJsonpws-client\"]=this[\"webpackJsonpws-client\"]||[]).push([[0],{12:function(e,t,n){e.exports=n(17)},17:function(e,t,n){\"use strict\";n.r(t);var a=n(2),r=n(3),s=n(4),i=n(1),c=n(5),o=n(0),l=n.n(o),u=n(8),h=n.n(u),d={DATA:0,SOCKET_STATUS:1},f=function(){function e(){Object(a.a)(this,e),this.websocket=null,this.data_callbacks=new Set,this.status_callbacks=new Set,this.EventType=d,this.buffer=[],this.sendBuffer()}return Object(r.a)(e,[{key:\"sendBuffer\",value:function(){var e=this,t=this.buffer.shift();if(void 0!==t){var n=t.data,a=new Uint8Array(n);this.websocket.send(a),setTimeout((function(){return e.sendBuffer()}),t.wait)}else setTimeout((function(){return e.sendBuffer()}),10)}},{key:\"notifyOnStatus\",value:function(e){console.log(\"Websocket status: \"+e);var t=!0,n=!1,a=void 0;try{for(var r,s=this.status_callbacks[Symbol.iterator]();!(t=(r=s.next()).done);t=!0){(0,r.value)(e)}}catch(i){n=!0,a=i}finally{try{t||null==s.return||s.return()}finally{if(n)throw a}}}},{key:\"notifyOnData\",value:function(e){var t=e.data,n=new Uint8Array(t);console.log(\"Recieved: \"+n);var a=!0,r=!1,s=void 0;try{for(var i,c=this.data_callbacks[Symbol.iterator]();!(a=(i=c.next()).done);a=!0){if((0,i.value)(n))break}}catch(o){r=!0,s=o}finally{try{a||null==c.return||c.return()}finally{if(r)throw s}}}},{key:\"open\",value:function(e){var t=this;this.close(),console.log(\"Opening websocket @ \"+e),this.websocket=new WebSocket(e),this.websocket.binaryType=\"arraybuffer\",this.websocket.onopen=function(e){return t.notifyOnStatus(!0)},this.websocket.onclose=function(e){return t.notifyOnStatus(!1)},this.websocket.onmessage=function(e){return t.notifyOnData(e)}}},{key:\"close\",value:function(){this.isActive()&&this.websocket.close(),this.websocket=null}},{key:\"isActive\",value:function(){return null!==this.websocket&&this.websocket.readyState===WebSocket.OPEN}},{key:\"send\",value:function(e){var t=arguments.length>1&&void 0!==arguments[1]?arguments[1]:10;if(this.isActive()){var n={data:e,wait:t};return this.buffer.push(n),!0}return!1}},{key:\"getCallbackList\",value:function(t){switch(t){case e.EventType.DATA:return this.data_callbacks;case e.EventType.SOCKET_STATUS:return this.status_callbacks;default:return}}},{key:\"listen\",value:function(e,t){var n=this.getCallbackList(t);return void 0!==n&&n.add(e),this}},{key:\"unlisten\",value:function(e,t){var n=this.getCallbackList(t);return void 0!==n&&n.delete(e)}}],[{key:\"EventType\",get:function(){return d}}]),e}(),m=n(6),b=n(9),v=n(7),p=function(e){function t(e){var n;return Object(a.a)(this,t),(n=Object(s.a)(this,Object(i.a)(t).call(this,e))).callbacks=[[n.dataListener.bind(Object(v.a)(n)),f.EventType.DATA],[n.statusListener.bind(Object(v.a)(n)),f.EventType.SOCKET_STATUS]],n.callbacks.map((function(e){n.props.websocket.listen(e[0],e[1])})),n.state={leds:[]},n.props.websocket.isActive()&&n.getInfo(),n}return Object(c.a)(t,e),Object(r.a)(t,[{key:\"componentWillUnmount\",value:function(){var e=this;this.callbacks.map((function(t){e.props.websocket.unlisten(t[0],t[1])}))}},{key:\"dataListener\",value:function(e){if(!(e.length<2||1!==e[0])){console.log(\"Getting data\");var t=e[1];return 2===t&&e.length>=3&&this.onInfo(e),!0}}},{key:\"statusListener\",value:function(e){e&&this.getInfo()}},{key:\"onInfo\",value:function(e){var t=e[2];if(t===e.length-3){for(var n=[],a=0;a<t;a++)n.push(e[a+3]);this.setState(Object(m.a)({},this.state,{leds:n}))}else console.warn(\"Incorrect match between data length and total leds\")}},{key:\"getInfo\",value:function(){this.props.websocket.send([1,2])}},{key:\"leds\",set:function(e){for(var t=[],n=0;n<e.length;n++){var a=255&e[n];a!==(255&this.state.leds[n])&&(t.push(n),t.push(a))}if(0!==t.length){var r=[1,1].concat(t);this.props.websocket.send(r),this.setState(Object(m.a)({},this.state,{leds:e}))}},get:function(){return this.state.leds}}]),t}(l.a.Component),k=function(e){function t(e){return Object(a.a)(this,t),Object(s.a)(this,Object(i.a)(t).call(this,e))}return Object(c.a)(t,e),Object(r.a)(t,[{key:\"onLedChange\",value:function(e,t){var n=t.target.value,a=Object(b.a)(this.leds);a[e]=n,this.leds=a}},{key:\"createSlider\",value:function(e,t){var n=this;return l.a.createElement(\"li\",{className:\"list-group-item d-flex justify-content-between align-items-center\"},l.a.createElement(\"input\",{className:\"custom-range mr-2 w-90\",type:\"range\",min:\"0\",max:\"128\",step:\"1\",value:e,onChange:function(e){return n.onLedChange(t,e)}}),l.a.createElement(\"span\",{className:\"badge badge-primary badge-pill\"},e))}},{key:\"render\",value:function(){for(var e=[],t=0;this.leds&&t<this.leds.length;t+=2){for(var n=[],a=0;a<2;a++){var r=t+a;if(r<this.leds.length){var s=this.leds[r];n.push(l.a.createElement(\"div\",{className:\"col\",key:r},this.createSlider(s,r)))}}e.push(l.a.createElement(\"div\",{className:\"row\",key:e.length},n))}return l.a.createElement(\"div\",{className:\"container-fluid\"},e)}}]),t}(p),y=n(10),w=0,g=1,O={Slider:k,Fader:function(e){function t(e){var n;return Object(a.a)(this,t),(n=Object(s.a)(this,Object(i.a)(t).call(this,e))).state={fadeValues:[],fadeDirection:[]},n}return Object(c.a)(t,e),Object(r.a)(t,[{key:\"componentDidMount\",value:function(){var e=this;this.interval=setInterval((function(){return e.updateLeds()}),33)}},{key:\"updateLeds\",value:function(){if(void 0!==this.leds){for(var e=Object(b.a)(this.leds),t=0;t<e.length;t++){var n=this.state.fadeDirection[t],a=this.state.fadeValues[t];switch(n){case g:e[t]+=a,e[t]>=128&&(e[t]=128,this.state.fadeDirection[t]=w);break;case w:e[t]-=a,e[t]<=0&&(e[t]=0,this.state.fadeDirection[t]=g)}}this.leds=e}}},{key:\"onInfo\",value:function(e){if(Object(y.a)(Object(i.a)(t.prototype),\"onInfo\",this).call(this,e),this.leds.length!==this.state.fadeValues.length){var n=this.leds.map((function(){return 0})),a=this.leds.map((function(){return g}));this.setState(Object(m.a)({},this.state,{fadeValues:n,fadeDirection:a}))}}},{key:\"componentWillUnmount\",value:function(){Object(y.a)(Object(i.a)(t.prototype),\"componentWillUnmount\",this).call(this),clearInterval(this.interval)}},{key:\"onFadeChange\",value:function(e,t){var n=Number(t.target.value),a=Object(b.a)(this.state.fadeValues);a[e]=n,this.setState(Object(m.a)({},this.state,{fadeValues:a}))}},{key:\"createSlider\",value:function(e,t){var n=this;return l.a.createElement(\"li\",{className:\"list-group-item d-flex justify-content-between align-items-center\"},l.a.createElement(\"input\",{className:\"custom-range mr-2 w-90\",type:\"range\",min:\"0\",max:\"20\",step:\"1\",value:e,onChange:function(e){return n.onFadeChange(t,e)}}),l.a.createElement(\"span\",{className:\"badge badge-primary badge-pill\"},e))}},{key:\"render\",value:function(){for(var e=[],t=this.state.fadeValues,n=0;n<t.length;n+=2){for(var a=[],r=0;r<2;r++){var s=n+r;if(s<t.length){var i=t[s];a.push(l.a.createElement(\"div\",{className:\"col\",key:s},this.createSlider(i,s)))}}e.push(l.a.createElement(\"div\",{className:\"row\",key:e.length},a))}return l.a.createElement(\"div\",{className:\"container-fluid\"},e)}}]),t}(p)},E=function(e){function t(e){var n;return Object(a.a)(this,t),(n=Object(s.a)(this,Object(i.a)(t).call(this,e))).controllers=O,n.state={leds:[],controller:\"Slider\"},n}return Object(c.a)(t,e),Object(r.a)(t,[{key:\"setController\",value:function(e){this.setState(Object(m.a)({},this.state,{controller:e}))}},{key:\"getControllerComponent\",value:function(e){var t=O[this.state.controller];return l.a.createElement(t,e)}},{key:\"renderControllers\",value:function(){var e=this;return Object.keys(this.controllers).map((function(t,n){return l.a.createElement(\"a\",{key:n,className:\"dropdown-item\",onClick:function(){return e.setController(t)}},t)}))}},{key:\"renderHeader\",value:function(){return l.a.createElement(\"div\",{className:\"d-flex justify-content-between flex-wrap flex-mid-nowrap align-items-center pb-2 mb-3 border-bottom\"},l.a.createElement(\"h3\",null,\"LED Controls\"),l.a.createElement(\"div\",{className:\"btn-toolbar mb-2 mb-md-0 dropdown\"},l.a.createElement(\"button\",{className:\"btn btn-sm btn-outline-secondary dropdown-toggle\",\"data-toggle\":\"dropdown\"},this.state.controller),l.a.createElement(\"div\",{className:\"dropdown-menu\",\"aria-labelledby\":\"dropdownMenuLink\"},this.renderControllers())))}},{key:\"render\",value:function(){return l.a.createElement(\"div\",null,this.renderHeader(),this.getControllerComponent({websocket:this.props.websocket}))}}]),t}(l.a.Component),j=function(e){function t(e){var n;return Object(a.a)(this,t),(n=Object(s.a)(this,Object(i.a)(t).call(this,e))).props.websocket.listen(n.dataListener.bind(Object(v.a)(n)),f.EventType.DATA),n.props.websocket.listen(n.getInfo.bind(Object(v.a)(n)),f.EventType.SOCKET_STATUS),n.state={isPowered:!1},n}return Object(c.a)(t,e),Object(r.a)(t,[{key:\"turnOn\",value:function(){this.props.websocket.send([2,2])}},{key:\"turnOff\",value:function(){this.props.websocket.send([2,1])}},{key:\"reset\",value:function(){this.props.websocket.send([2,3])}},{key:\"dataListener\",value:function(e){if(!(e.length<3||2!==e[0]))return this.onInfo(e),!0}},{key:\"onInfo\",value:function(e){var t=e[1],n=e[2];switch(t){case 4:this.setState(Object(m.a)({},this.state,{isPowered:n>0}));break;default:console.warn(\"Unhandled pc io command: \"+t)}}},{key:\"getInfo\",value:function(e){e&&this.props.websocket.send([2,4])}},{key:\"renderPowerButton\",value:function(){var e=this,t=this.state.isPowered?function(){return e.turnOff()}:function(){return e.turnOn()},n=this.state.isPowered?\"btn-danger\":\"btn-success\";return l.a.createElement(\"button\",{type:\"button\",className:\"btn \"+n,onClick:t},l.a.createElement(\"i\",{className:\"fa fa-power-off\"}))}},{key:\"renderResetButton\",value:function(){var e=this;return l.a.createElement(\"button\",{type:\"button\",className:\"btn btn-warning\",onClick:function(){return e.reset()}},l.a.createElement(\"i\",{className:\"fa fa-redo\"}))}},{key:\"render\",value:function(){return l.a.createElement(\"div\",{className:\"navbar-nav col\"},l.a.createElement(\"div\",{className:\"btn-group\",role:\"group\"},this.renderPowerButton(),this.renderResetButton()))}}]),t}(l.a.Component),N=[\"temperature-low\",\"thermometer-quarter\",\"thermometer-half\",\"thermometer-three-quarters\",\"temperature-high\"],C=function(e){function t(e){var n;return Object(a.a)(this,t),(n=Object(s.a)(this,Object(i.a)(t).call(this,e))).props.websocket.listen(n.dataListener.bind(Object(v.a)(n)),f.EventType.DATA),n.props.websocket.listen((function(e){e&&n.getInfo()}),f.EventType.SOCKET_STATUS),n.state={temperature:0,humidity:0},n}return Object(c.a)(t,e),Object(r.a)(t,[{key:\"dataListener\",value:function(e){if(!(e.length<3||3!==e[0]))return this.onInfo(e),!0}},{key:\"onInfo\",value:function(e){var t=e[1],n=e[2];this.setState(Object(m.a)({},this.state,{humidity:t,temperature:n}))}},{key:\"getInfo\",value:function(){this.props.websocket.send([3],300)}},{key:\"renderBar\",value:function(e,t,n,a,r,s){var i={fontSize:a+\"em\"},c={height:r+\"em\"};return l.a.createElement(\"div\",{className:\"progress\",style:c},l.a.createElement(\"div\",{className:\"progress-bar \"+n,role:\"progressbar\",style:{width:s+\"%\"}},l.a.createElement(\"div\",{className:\"d-flex d-inline justify-content-center align-items-center\"},l.a.createElement(\"i\",{className:\"fa fa-\"+e,style:i}),l.a.createElement(\"div\",{className:\"ml-3 text\",style:i},t))))}},{key:\"renderTemperature\",value:function(){var e=this.state.temperature/50*100,t=(this.state.temperature-10)/10;t=Math.round(t),t=Math.min(t,N.length-1),t=Math.max(t,0);var n=N[t],a=this.state.temperature+\"\\xb0C\";return this.renderBar(n,a,\"bg-danger\",2.5,3.5,e)}},{key:\"renderHumidity\",value:function(){var e=this.state.humidity,t=this.state.humidity+\"%\";return this.renderBar(\"tint\",t,\"bg-primary\",2.5,3.5,e)}},{key:\"render\",value:function(){var e=this;return l.a.createElement(\"div\",null,l.a.createElement(\"div\",{className:\"d-flex justify-content-between flex-wrap flex-mid-nowrap align-items-center border-bottom pb-2 mt-3 mb-3\"},l.a.createElement(\"h3\",null,\"DHT11\"),l.a.createElement(\"button\",{className:\"btn btn-sm btn-outline-secondary\",onClick:function(){return e.getInfo()}},\"Refresh\")),l.a.createElement(\"div\",{className:\"container-fluid\"},l.a.createElement(\"div\",{className:\"row\"},l.a.createElement(\"div\",{className:\"col\"},this.renderTemperature()),l.a.createElement(\"div\",{className:\"col\"},this.renderHumidity()))))}}]),t}(l.a.Component),S=function(e){function t(e){var n;return Object(a.a)(this,t),(n=Object(s.a)(this,Object(i.a)(t).call(this,e))).props.websocket.listen(n.setStatus.bind(Object(v.a)(n)),f.EventType.SOCKET_STATUS),n.state={isConnected:!1,url:\"ws://\"+window.location.hostname+\":3200/api/v1/websocket\"},setTimeout((function(){return n.open()}),0),n}return Object(c.a)(t,e),Object(r.a)(t,[{key:\"open\",value:function(){this.props.websocket.open(this.state.url)}},{key:\"close\",value:function(){this.props.websocket.close()}},{key:\"setStatus\",value:function(e){this.setState(Object(m.a)({},this.state,{isConnected:e}))}},{key:\"onURLChange\",value:function(e){var t=e.target.value;this.setState(Object(m.a)({},this.state,{url:t}))}},{key:\"renderURL\",value:function(){var e=this;return l.a.createElement(\"div\",{className:\"input-group\"},l.a.createElement(\"div\",{className:\"input-group-prepend\"},l.a.createElement(\"span\",{className:\"input-group-text\"},l.a.createElement(\"i\",{className:\"fa fa-plug\"}))),l.a.createElement(\"input\",{className:\"form-control form-control-light\",value:this.state.url,onChange:this.onURLChange.bind(this),onKeyDown:function(t){\"Enter\"===t.key&&e.open()},spellCheck:!1,type:\"url\",\"aria-label\":\"URL\"}),this.renderControls())}},{key:\"renderControls\",value:function(){var e=this,t=this.state.isConnected?\"btn-danger\":\"btn-success\",n=this.state.isConnected?function(){return e.close()}:function(){return e.open()},a=this.state.isConnected?\"fa fa-unlink\":\"fa fa-link\";return l.a.createElement(\"div\",{className:\"input-group-append\"},l.a.createElement(\"button\",{type:\"button\",className:\"btn \"+t,onClick:n},l.a.createElement(\"i\",{className:a})))}},{key:\"render\",value:function(){return l.a.createElement(\"div\",{className:\"flex-md-nowrap w-100\"},l.a.createElement(\"div\",{className:\"row\"},l.a.createElement(\"div\",{className:\"input-group col\"},this.renderURL())))}}]),t}(l.a.Component),T=function(e){function t(e){var n;return Object(a.a)(this,t),(n=Object(s.a)(this,Object(i.a)(t).call(this,e))).websocket=new f,n}return Object(c.a)(t,e),Object(r.a)(t,[{key:\"render\",value:function(){return l.a.createElement(\"main\",null,l.a.createElement(\"nav\",{className:\"navbar navbar-dark sticky-top bg-dark\"},l.a.createElement(\"div\",{className:\"container flex-md-nowrap\"},l.a.createElement(j,{websocket:this.websocket}),l.a.createElement(S,{websocket:this.websocket}))),l.a.createElement(\"div\",{className:\"container mt-2\"},l.a.createElement(E,{websocket:this.websocket}),l.a.createElement(C,{websocket:this.websocket})))}}]),t}(l.a.Component);h.a.render(l.a.createElement(T,null),document.getElementById(\"root\"))}},[[12,1,2]]]);\n//# sourceMappingURL=main.3a9ce051.chunk.js.map";
-const char chunk_js_file[] = "(this[\"webpackJsonpws-client\"]=this[\"webpackJsonpws-client\"]||[]).push([[2],[function(e,t,n){\"use strict\";e.exports=n(13)},function(e,t,n){\"use strict\";function r(e){return(r=Object.setPrototypeOf?Object.getPrototypeOf:function(e){return e.__proto__||Object.getPrototypeOf(e)})(e)}n.d(t,\"a\",(function(){return r}))},function(e,t,n){\"use strict\";function r(e,t){if(!(e instanceof t))throw new TypeError(\"Cannot call a class as a function\")}n.d(t,\"a\",(function(){return r}))},function(e,t,n){\"use strict\";function r(e,t){for(var n=0;n<t.length;n++){var r=t[n];r.enumerable=r.enumerable||!1,r.configurable=!0,\"value\"in r&&(r.writable=!0),Object.defineProperty(e,r.key,r)}}function l(e,t,n){return t&&r(e.prototype,t),n&&r(e,n),e}n.d(t,\"a\",(function(){return l}))},function(e,t,n){\"use strict\";function r(e){return(r=\"function\"===typeof Symbol&&\"symbol\"===typeof Symbol.iterator?function(e){return typeof e}:function(e){return e&&\"function\"===typeof Symbol&&e.constructor===Symbol&&e!==Symbol.prototype?\"symbol\":typeof e})(e)}var l=n(7);function i(e,t){return!t||\"object\"!==r(t)&&\"function\"!==typeof t?Object(l.a)(e):t}n.d(t,\"a\",(function(){return i}))},function(e,t,n){\"use strict\";function r(e,t){return(r=Object.setPrototypeOf||function(e,t){return e.__proto__=t,e})(e,t)}function l(e,t){if(\"function\"!==typeof t&&null!==t)throw new TypeError(\"Super expression must either be null or a function\");e.prototype=Object.create(t&&t.prototype,{constructor:{value:e,writable:!0,configurable:!0}}),t&&r(e,t)}n.d(t,\"a\",(function(){return l}))},function(e,t,n){\"use strict\";function r(e,t,n){return t in e?Object.defineProperty(e,t,{value:n,enumerable:!0,configurable:!0,writable:!0}):e[t]=n,e}function l(e,t){var n=Object.keys(e);if(Object.getOwnPropertySymbols){var r=Object.getOwnPropertySymbols(e);t&&(r=r.filter((function(t){return Object.getOwnPropertyDescriptor(e,t).enumerable}))),n.push.apply(n,r)}return n}function i(e){for(var t=1;t<arguments.length;t++){var n=null!=arguments[t]?arguments[t]:{};t%2?l(Object(n),!0).forEach((function(t){r(e,t,n[t])})):Object.getOwnPropertyDescriptors?Object.defineProperties(e,Object.getOwnPropertyDescriptors(n)):l(Object(n)).forEach((function(t){Object.defineProperty(e,t,Object.getOwnPropertyDescriptor(n,t))}))}return e}n.d(t,\"a\",(function(){return i}))},function(e,t,n){\"use strict\";function r(e){if(void 0===e)throw new ReferenceError(\"this hasn't been initialised - super() hasn't been called\");return e}n.d(t,\"a\",(function(){return r}))},function(e,t,n){\"use strict\";!function e(){if(\"undefined\"!==typeof __REACT_DEVTOOLS_GLOBAL_HOOK__&&\"function\"===typeof __REACT_DEVTOOLS_GLOBAL_HOOK__.checkDCE){0;try{__REACT_DEVTOOLS_GLOBAL_HOOK__.checkDCE(e)}catch(t){console.error(t)}}}(),e.exports=n(14)},function(e,t,n){\"use strict\";function r(e){return function(e){if(Array.isArray(e)){for(var t=0,n=new Array(e.length);t<e.length;t++)n[t]=e[t];return n}}(e)||function(e){if(Symbol.iterator in Object(e)||\"[object Arguments]\"===Object.prototype.toString.call(e))return Array.from(e)}(e)||function(){throw new TypeError(\"Invalid attempt to spread non-iterable instance\")}()}n.d(t,\"a\",(function(){return r}))},function(e,t,n){\"use strict\";var r=n(1);function l(e,t,n){return(l=\"undefined\"!==typeof Reflect&&Reflect.get?Reflect.get:function(e,t,n){var l=function(e,t){for(;!Object.prototype.hasOwnProperty.call(e,t)&&null!==(e=Object(r.a)(e)););return e}(e,t);if(l){var i=Object.getOwnPropertyDescriptor(l,t);return i.get?i.get.call(n):i.value}})(e,t,n||e)}n.d(t,\"a\",(function(){return l}))},function(e,t,n){\"use strict\";var r=Object.getOwnPropertySymbols,l=Object.prototype.hasOwnProperty,i=Object.prototype.propertyIsEnumerable;function a(e){if(null===e||void 0===e)throw new TypeError(\"Object.assign cannot be called with null or undefined\");return Object(e)}e.exports=function(){try{if(!Object.assign)return!1;var e=new String(\"abc\");if(e[5]=\"de\",\"5\"===Object.getOwnPropertyNames(e)[0])return!1;for(var t={},n=0;n<10;n++)t[\"_\"+String.fromCharCode(n)]=n;if(\"0123456789\"!==Object.getOwnPropertyNames(t).map((function(e){return t[e]})).join(\"\"))return!1;var r={};return\"abcdefghijklmnopqrst\".split(\"\").forEach((function(e){r[e]=e})),\"abcdefghijklmnopqrst\"===Object.keys(Object.assign({},r)).join(\"\")}catch(l){return!1}}()?Object.assign:function(e,t){for(var n,o,u=a(e),c=1;c<arguments.length;c++){for(var s in n=Object(arguments[c]))l.call(n,s)&&(u[s]=n[s]);if(r){o=r(n);for(var f=0;f<o.length;f++)i.call(n,o[f])&&(u[o[f]]=n[o[f]])}}return u}},,function(e,t,n){\"use strict\";var r=n(11),l=\"function\"===typeof Symbol&&Symbol.for,i=l?Symbol.for(\"react.element\"):60103,a=l?Symbol.for(\"react.portal\"):60106,o=l?Symbol.for(\"react.fragment\"):60107,u=l?Symbol.for(\"react.strict_mode\"):60108,c=l?Symbol.for(\"react.profiler\"):60114,s=l?Symbol.for(\"react.provider\"):60109,f=l?Symbol.for(\"react.context\"):60110,d=l?Symbol.for(\"react.forward_ref\"):60112,p=l?Symbol.for(\"react.suspense\"):60113;l&&Symbol.for(\"react.suspense_list\");var m=l?Symbol.for(\"react.memo\"):60115,h=l?Symbol.for(\"react.lazy\"):60116;l&&Symbol.for(\"react.fundamental\"),l&&Symbol.for(\"react.responder\"),l&&Symbol.for(\"react.scope\");var y=\"function\"===typeof Symbol&&Symbol.iterator;function v(e){for(var t=\"https://reactjs.org/docs/error-decoder.html?invariant=\"+e,n=1;n<arguments.length;n++)t+=\"&args[]=\"+encodeURIComponent(arguments[n]);return\"Minified React error #\"+e+\"; visit \"+t+\" for the full message or use the non-minified dev environment for full errors and additional helpful warnings.\"}var g={isMounted:function(){return!1},enqueueForceUpdate:function(){},enqueueReplaceState:function(){},enqueueSetState:function(){}},b={};function w(e,t,n){this.props=e,this.context=t,this.refs=b,this.updater=n||g}function k(){}function E(e,t,n){this.props=e,this.context=t,this.refs=b,this.updater=n||g}w.prototype.isReactComponent={},w.prototype.setState=function(e,t){if(\"object\"!==typeof e&&\"function\"!==typeof e&&null!=e)throw Error(v(85));this.updater.enqueueSetState(this,e,t,\"setState\")},w.prototype.forceUpdate=function(e){this.updater.enqueueForceUpdate(this,e,\"forceUpdate\")},k.prototype=w.prototype;var x=E.prototype=new k;x.constructor=E,r(x,w.prototype),x.isPureReactComponent=!0;var T={current:null},S={current:null},C=Object.prototype.hasOwnProperty,_={key:!0,ref:!0,__self:!0,__source:!0};function P(e,t,n){var r,l={},a=null,o=null;if(null!=t)for(r in void 0!==t.ref&&(o=t.ref),void 0!==t.key&&(a=\"\"+t.key),t)C.call(t,r)&&!_.hasOwnProperty(r)&&(l[r]=t[r]);var u=arguments.length-2;if(1===u)l.children=n;else if(1<u){for(var c=Array(u),s=0;s<u;s++)c[s]=arguments[s+2];l.children=c}if(e&&e.defaultProps)for(r in u=e.defaultProps)void 0===l[r]&&(l[r]=u[r]);return{$$typeof:i,type:e,key:a,ref:o,props:l,_owner:S.current}}function N(e){return\"object\"===typeof e&&null!==e&&e.$$typeof===i}var O=/\\/+/g,z=[];function M(e,t,n,r){if(z.length){var l=z.pop();return l.result=e,l.keyPrefix=t,l.func=n,l.context=r,l.count=0,l}return{result:e,keyPrefix:t,func:n,context:r,count:0}}function R(e){e.result=null,e.keyPrefix=null,e.func=null,e.context=null,e.count=0,10>z.length&&z.push(e)}function I(e,t,n){return null==e?0:function e(t,n,r,l){var o=typeof t;\"undefined\"!==o&&\"boolean\"!==o||(t=null);var u=!1;if(null===t)u=!0;else switch(o){case\"string\":case\"number\":u=!0;break;case\"object\":switch(t.$$typeof){case i:case a:u=!0}}if(u)return r(l,t,\"\"===n?\".\"+F(t,0):n),1;if(u=0,n=\"\"===n?\".\":n+\":\",Array.isArray(t))for(var c=0;c<t.length;c++){var s=n+F(o=t[c],c);u+=e(o,s,r,l)}else if(null===t||\"object\"!==typeof t?s=null:s=\"function\"===typeof(s=y&&t[y]||t[\"@@iterator\"])?s:null,\"function\"===typeof s)for(t=s.call(t),c=0;!(o=t.next()).done;)u+=e(o=o.value,s=n+F(o,c++),r,l);else if(\"object\"===o)throw r=\"\"+t,Error(v(31,\"[object Object]\"===r?\"object with keys {\"+Object.keys(t).join(\", \")+\"}\":r,\"\"));return u}(e,\"\",t,n)}function F(e,t){return\"object\"===typeof e&&null!==e&&null!=e.key?function(e){var t={\"=\":\"=0\",\":\":\"=2\"};return\"$\"+(\"\"+e).replace(/[=:]/g,(function(e){return t[e]}))}(e.key):t.toString(36)}function U(e,t){e.func.call(e.context,t,e.count++)}function D(e,t,n){var r=e.result,l=e.keyPrefix;e=e.func.call(e.context,t,e.count++),Array.isArray(e)?L(e,r,n,(function(e){return e})):null!=e&&(N(e)&&(e=function(e,t){return{$$typeof:i,type:e.type,key:t,ref:e.ref,props:e.props,_owner:e._owner}}(e,l+(!e.key||t&&t.key===e.key?\"\":(\"\"+e.key).replace(O,\"$&/\")+\"/\")+n)),r.push(e))}function L(e,t,n,r,l){var i=\"\";null!=n&&(i=(\"\"+n).replace(O,\"$&/\")+\"/\"),I(e,D,t=M(t,i,r,l)),R(t)}function j(){var e=T.current;if(null===e)throw Error(v(321));return e}var A={Children:{map:function(e,t,n){if(null==e)return e;var r=[];return L(e,r,null,t,n),r},forEach:function(e,t,n){if(null==e)return e;I(e,U,t=M(null,null,t,n)),R(t)},count:function(e){return I(e,(function(){return null}),null)},toArray:function(e){var t=[];return L(e,t,null,(function(e){return e})),t},only:function(e){if(!N(e))throw Error(v(143));return e}},createRef:function(){return{current:null}},Component:w,PureComponent:E,createContext:function(e,t){return void 0===t&&(t=null),(e={$$typeof:f,_calculateChangedBits:t,_currentValue:e,_currentValue2:e,_threadCount:0,Provider:null,Consumer:null}).Provider={$$typeof:s,_context:e},e.Consumer=e},forwardRef:function(e){return{$$typeof:d,render:e}},lazy:function(e){return{$$typeof:h,_ctor:e,_status:-1,_result:null}},memo:function(e,t){return{$$typeof:m,type:e,compare:void 0===t?null:t}},useCallback:function(e,t){return j().useCallback(e,t)},useContext:function(e,t){return j().useContext(e,t)},useEffect:function(e,t){return j().useEffect(e,t)},useImperativeHandle:function(e,t,n){return j().useImperativeHandle(e,t,n)},useDebugValue:function(){},useLayoutEffect:function(e,t){return j().useLayoutEffect(e,t)},useMemo:function(e,t){return j().useMemo(e,t)},useReducer:function(e,t,n){return j().useReducer(e,t,n)},useRef:function(e){return j().useRef(e)},useState:function(e){return j().useState(e)},Fragment:o,Profiler:c,StrictMode:u,Suspense:p,createElement:P,cloneElement:function(e,t,n){if(null===e||void 0===e)throw Error(v(267,e));var l=r({},e.props),a=e.key,o=e.ref,u=e._owner;if(null!=t){if(void 0!==t.ref&&(o=t.ref,u=S.current),void 0!==t.key&&(a=\"\"+t.key),e.type&&e.type.defaultProps)var c=e.type.defaultProps;for(s in t)C.call(t,s)&&!_.hasOwnProperty(s)&&(l[s]=void 0===t[s]&&void 0!==c?c[s]:t[s])}var s=arguments.length-2;if(1===s)l.children=n;else if(1<s){c=Array(s);for(var f=0;f<s;f++)c[f]=arguments[f+2];l.children=c}return{$$typeof:i,type:e.type,key:a,ref:o,props:l,_owner:u}},createFactory:function(e){var t=P.bind(null,e);return t.type=e,t},isValidElement:N,version:\"16.12.0\",__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED:{ReactCurrentDispatcher:T,ReactCurrentBatchConfig:{suspense:null},ReactCurrentOwner:S,IsSomeRendererActing:{current:!1},assign:r}},V={default:A},W=V&&A||V;e.exports=W.default||W},function(e,t,n){\"use strict\";var r=n(0),l=n(11),i=n(15);function a(e){for(var t=\"https://reactjs.org/docs/error-decoder.html?invariant=\"+e,n=1;n<arguments.length;n++)t+=\"&args[]=\"+encodeURIComponent(arguments[n]);return\"Minified React error #\"+e+\"; visit \"+t+\" for the full message or use the non-minified dev environment for full errors and additional helpful warnings.\"}if(!r)throw Error(a(227));var o=null,u={};function c(){if(o)for(var e in u){var t=u[e],n=o.indexOf(e);if(!(-1<n))throw Error(a(96,e));if(!f[n]){if(!t.extractEvents)throw Error(a(97,e));for(var r in f[n]=t,n=t.eventTypes){var l=void 0,i=n[r],c=t,p=r;if(d.hasOwnProperty(p))throw Error(a(99,p));d[p]=i;var m=i.phasedRegistrationNames;if(m){for(l in m)m.hasOwnProperty(l)&&s(m[l],c,p);l=!0}else i.registrationName?(s(i.registrationName,c,p),l=!0):l=!1;if(!l)throw Error(a(98,r,e))}}}}function s(e,t,n){if(p[e])throw Error(a(100,e));p[e]=t,m[e]=t.eventTypes[n].dependencies}var f=[],d={},p={},m={};function h(e,t,n,r,l,i,a,o,u){var c=Array.prototype.slice.call(arguments,3);try{t.apply(n,c)}catch(s){this.onError(s)}}var y=!1,v=null,g=!1,b=null,w={onError:function(e){y=!0,v=e}};function k(e,t,n,r,l,i,a,o,u){y=!1,v=null,h.apply(w,arguments)}var E=null,x=null,T=null;function S(e,t,n){var r=e.type||\"unknown-event\";e.currentTarget=T(n),function(e,t,n,r,l,i,o,u,c){if(k.apply(this,arguments),y){if(!y)throw Error(a(198));var s=v;y=!1,v=null,g||(g=!0,b=s)}}(r,t,void 0,e),e.currentTarget=null}function C(e,t){if(null==t)throw Error(a(30));return null==e?t:Array.isArray(e)?Array.isArray(t)?(e.push.apply(e,t),e):(e.push(t),e):Array.isArray(t)?[e].concat(t):[e,t]}function _(e,t,n){Array.isArray(e)?e.forEach(t,n):e&&t.call(n,e)}var P=null;function N(e){if(e){var t=e._dispatchListeners,n=e._dispatchInstances;if(Array.isArray(t))for(var r=0;r<t.length&&!e.isPropagationStopped();r++)S(e,t[r],n[r]);else t&&S(e,t,n);e._dispatchListeners=null,e._dispatchInstances=null,e.isPersistent()||e.constructor.release(e)}}function O(e){if(null!==e&&(P=C(P,e)),e=P,P=null,e){if(_(e,N),P)throw Error(a(95));if(g)throw e=b,g=!1,b=null,e}}var z={injectEventPluginOrder:function(e){if(o)throw Error(a(101));o=Array.prototype.slice.call(e),c()},injectEventPluginsByName:function(e){var t,n=!1;for(t in e)if(e.hasOwnProperty(t)){var r=e[t];if(!u.hasOwnProperty(t)||u[t]!==r){if(u[t])throw Error(a(102,t));u[t]=r,n=!0}}n&&c()}};function M(e,t){var n=e.stateNode;if(!n)return null;var r=E(n);if(!r)return null;n=r[t];e:switch(t){case\"onClick\":case\"onClickCapture\":case\"onDoubleClick\":case\"onDoubleClickCapture\":case\"onMouseDown\":case\"onMouseDownCapture\":case\"onMouseMove\":case\"onMouseMoveCapture\":case\"onMouseUp\":case\"onMouseUpCapture\":(r=!r.disabled)||(r=!(\"button\"===(e=e.type)||\"input\"===e||\"select\"===e||\"textarea\"===e)),e=!r;break e;default:e=!1}if(e)return null;if(n&&\"function\"!==typeof n)throw Error(a(231,t,typeof n));return n}var R=r.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED;R.hasOwnProperty(\"ReactCurrentDispatcher\")||(R.ReactCurrentDispatcher={current:null}),R.hasOwnProperty(\"ReactCurrentBatchConfig\")||(R.ReactCurrentBatchConfig={suspense:null});var I=/^(.*)[\\\\\\/]/,F=\"function\"===typeof Symbol&&Symbol.for,U=F?Symbol.for(\"react.element\"):60103,D=F?Symbol.for(\"react.portal\"):60106,L=F?Symbol.for(\"react.fragment\"):60107,j=F?Symbol.for(\"react.strict_mode\"):60108,A=F?Symbol.for(\"react.profiler\"):60114,V=F?Symbol.for(\"react.provider\"):60109,W=F?Symbol.for(\"react.context\"):60110,$=F?Symbol.for(\"react.concurrent_mode\"):60111,B=F?Symbol.for(\"react.forward_ref\"):60112,H=F?Symbol.for(\"react.suspense\"):60113,Q=F?Symbol.for(\"react.suspense_list\"):60120,K=F?Symbol.for(\"react.memo\"):60115,q=F?Symbol.for(\"react.lazy\"):60116;F&&Symbol.for(\"react.fundamental\"),F&&Symbol.for(\"react.responder\"),F&&Symbol.for(\"react.scope\");var Y=\"function\"===typeof Symbol&&Symbol.iterator;function X(e){return null===e||\"object\"!==typeof e?null:\"function\"===typeof(e=Y&&e[Y]||e[\"@@iterator\"])?e:null}function G(e){if(null==e)return null;if(\"function\"===typeof e)return e.displayName||e.name||null;if(\"string\"===typeof e)return e;switch(e){case L:return\"Fragment\";case D:return\"Portal\";case A:return\"Profiler\";case j:return\"StrictMode\";case H:return\"Suspense\";case Q:return\"SuspenseList\"}if(\"object\"===typeof e)switch(e.$$typeof){case W:return\"Context.Consumer\";case V:return\"Context.Provider\";case B:var t=e.render;return t=t.displayName||t.name||\"\",e.displayName||(\"\"!==t?\"ForwardRef(\"+t+\")\":\"ForwardRef\");case K:return G(e.type);case q:if(e=1===e._status?e._result:null)return G(e)}return null}function J(e){var t=\"\";do{e:switch(e.tag){case 3:case 4:case 6:case 7:case 10:case 9:var n=\"\";break e;default:var r=e._debugOwner,l=e._debugSource,i=G(e.type);n=null,r&&(n=G(r.type)),r=i,i=\"\",l?i=\" (at \"+l.fileName.replace(I,\"\")+\":\"+l.lineNumber+\")\":n&&(i=\" (created by \"+n+\")\"),n=\"\\n    in \"+(r||\"Unknown\")+i}t+=n,e=e.return}while(e);return t}var Z=!(\"undefined\"===typeof window||\"undefined\"===typeof window.document||\"undefined\"===typeof window.document.createElement),ee=null,te=null,ne=null;function re(e){if(e=x(e)){if(\"function\"!==typeof ee)throw Error(a(280));var t=E(e.stateNode);ee(e.stateNode,e.type,t)}}function le(e){te?ne?ne.push(e):ne=[e]:te=e}function ie(){if(te){var e=te,t=ne;if(ne=te=null,re(e),t)for(e=0;e<t.length;e++)re(t[e])}}function ae(e,t){return e(t)}function oe(e,t,n,r){return e(t,n,r)}function ue(){}var ce=ae,se=!1,fe=!1;function de(){null===te&&null===ne||(ue(),ie())}new Map;var pe=/^[:A-Z_a-z\\u00C0-\\u00D6\\u00D8-\\u00F6\\u00F8-\\u02FF\\u0370-\\u037D\\u037F-\\u1FFF\\u200C-\\u200D\\u2070-\\u218F\\u2C00-\\u2FEF\\u3001-\\uD7FF\\uF900-\\uFDCF\\uFDF0-\\uFFFD][:A-Z_a-z\\u00C0-\\u00D6\\u00D8-\\u00F6\\u00F8-\\u02FF\\u0370-\\u037D\\u037F-\\u1FFF\\u200C-\\u200D\\u2070-\\u218F\\u2C00-\\u2FEF\\u3001-\\uD7FF\\uF900-\\uFDCF\\uFDF0-\\uFFFD\\-.0-9\\u00B7\\u0300-\\u036F\\u203F-\\u2040]*$/,me=Object.prototype.hasOwnProperty,he={},ye={};function ve(e,t,n,r,l,i){this.acceptsBooleans=2===t||3===t||4===t,this.attributeName=r,this.attributeNamespace=l,this.mustUseProperty=n,this.propertyName=e,this.type=t,this.sanitizeURL=i}var ge={};\"children dangerouslySetInnerHTML defaultValue defaultChecked innerHTML suppressContentEditableWarning suppressHydrationWarning style\".split(\" \").forEach((function(e){ge[e]=new ve(e,0,!1,e,null,!1)})),[[\"acceptCharset\",\"accept-charset\"],[\"className\",\"class\"],[\"htmlFor\",\"for\"],[\"httpEquiv\",\"http-equiv\"]].forEach((function(e){var t=e[0];ge[t]=new ve(t,1,!1,e[1],null,!1)})),[\"contentEditable\",\"draggable\",\"spellCheck\",\"value\"].forEach((function(e){ge[e]=new ve(e,2,!1,e.toLowerCase(),null,!1)})),[\"autoReverse\",\"externalResourcesRequired\",\"focusable\",\"preserveAlpha\"].forEach((function(e){ge[e]=new ve(e,2,!1,e,null,!1)})),\"allowFullScreen async autoFocus autoPlay controls default defer disabled disablePictureInPicture formNoValidate hidden loop noModule noValidate open playsInline readOnly required reversed scoped seamless itemScope\".split(\" \").forEach((function(e){ge[e]=new ve(e,3,!1,e.toLowerCase(),null,!1)})),[\"checked\",\"multiple\",\"muted\",\"selected\"].forEach((function(e){ge[e]=new ve(e,3,!0,e,null,!1)})),[\"capture\",\"download\"].forEach((function(e){ge[e]=new ve(e,4,!1,e,null,!1)})),[\"cols\",\"rows\",\"size\",\"span\"].forEach((function(e){ge[e]=new ve(e,6,!1,e,null,!1)})),[\"rowSpan\",\"start\"].forEach((function(e){ge[e]=new ve(e,5,!1,e.toLowerCase(),null,!1)}));var be=/[\\-:]([a-z])/g;function we(e){return e[1].toUpperCase()}function ke(e){switch(typeof e){case\"boolean\":case\"number\":case\"object\":case\"string\":case\"undefined\":return e;default:return\"\"}}function Ee(e,t,n,r){var l=ge.hasOwnProperty(t)?ge[t]:null;(null!==l?0===l.type:!r&&(2<t.length&&(\"o\"===t[0]||\"O\"===t[0])&&(\"n\"===t[1]||\"N\"===t[1])))||(function(e,t,n,r){if(null===t||\"undefined\"===typeof t||function(e,t,n,r){if(null!==n&&0===n.type)return!1;switch(typeof t){case\"function\":case\"symbol\":return!0;case\"boolean\":return!r&&(null!==n?!n.acceptsBooleans:\"data-\"!==(e=e.toLowerCase().slice(0,5))&&\"aria-\"!==e);default:return!1}}(e,t,n,r))return!0;if(r)return!1;if(null!==n)switch(n.type){case 3:return!t;case 4:return!1===t;case 5:return isNaN(t);case 6:return isNaN(t)||1>t}return!1}(t,n,l,r)&&(n=null),r||null===l?function(e){return!!me.call(ye,e)||!me.call(he,e)&&(pe.test(e)?ye[e]=!0:(he[e]=!0,!1))}(t)&&(null===n?e.removeAttribute(t):e.setAttribute(t,\"\"+n)):l.mustUseProperty?e[l.propertyName]=null===n?3!==l.type&&\"\":n:(t=l.attributeName,r=l.attributeNamespace,null===n?e.removeAttribute(t):(n=3===(l=l.type)||4===l&&!0===n?\"\":\"\"+n,r?e.setAttributeNS(r,t,n):e.setAttribute(t,n))))}function xe(e){var t=e.type;return(e=e.nodeName)&&\"input\"===e.toLowerCase()&&(\"checkbox\"===t||\"radio\"===t)}function Te(e){e._valueTracker||(e._valueTracker=function(e){var t=xe(e)?\"checked\":\"value\",n=Object.getOwnPropertyDescriptor(e.constructor.prototype,t),r=\"\"+e[t];if(!e.hasOwnProperty(t)&&\"undefined\"!==typeof n&&\"function\"===typeof n.get&&\"function\"===typeof n.set){var l=n.get,i=n.set;return Object.defineProperty(e,t,{configurable:!0,get:function(){return l.call(this)},set:function(e){r=\"\"+e,i.call(this,e)}}),Object.defineProperty(e,t,{enumerable:n.enumerable}),{getValue:function(){return r},setValue:function(e){r=\"\"+e},stopTracking:function(){e._valueTracker=null,delete e[t]}}}}(e))}function Se(e){if(!e)return!1;var t=e._valueTracker;if(!t)return!0;var n=t.getValue(),r=\"\";return e&&(r=xe(e)?e.checked?\"true\":\"false\":e.value),(e=r)!==n&&(t.setValue(e),!0)}function Ce(e,t){var n=t.checked;return l({},t,{defaultChecked:void 0,defaultValue:void 0,value:void 0,checked:null!=n?n:e._wrapperState.initialChecked})}function _e(e,t){var n=null==t.defaultValue?\"\":t.defaultValue,r=null!=t.checked?t.checked:t.defaultChecked;n=ke(null!=t.value?t.value:n),e._wrapperState={initialChecked:r,initialValue:n,controlled:\"checkbox\"===t.type||\"radio\"===t.type?null!=t.checked:null!=t.value}}function Pe(e,t){null!=(t=t.checked)&&Ee(e,\"checked\",t,!1)}function Ne(e,t){Pe(e,t);var n=ke(t.value),r=t.type;if(null!=n)\"number\"===r?(0===n&&\"\"===e.value||e.value!=n)&&(e.value=\"\"+n):e.value!==\"\"+n&&(e.value=\"\"+n);else if(\"submit\"===r||\"reset\"===r)return void e.removeAttribute(\"value\");t.hasOwnProperty(\"value\")?ze(e,t.type,n):t.hasOwnProperty(\"defaultValue\")&&ze(e,t.type,ke(t.defaultValue)),null==t.checked&&null!=t.defaultChecked&&(e.defaultChecked=!!t.defaultChecked)}function Oe(e,t,n){if(t.hasOwnProperty(\"value\")||t.hasOwnProperty(\"defaultValue\")){var r=t.type;if(!(\"submit\"!==r&&\"reset\"!==r||void 0!==t.value&&null!==t.value))return;t=\"\"+e._wrapperState.initialValue,n||t===e.value||(e.value=t),e.defaultValue=t}\"\"!==(n=e.name)&&(e.name=\"\"),e.defaultChecked=!e.defaultChecked,e.defaultChecked=!!e._wrapperState.initialChecked,\"\"!==n&&(e.name=n)}function ze(e,t,n){\"number\"===t&&e.ownerDocument.activeElement===e||(null==n?e.defaultValue=\"\"+e._wrapperState.initialValue:e.defaultValue!==\"\"+n&&(e.defaultValue=\"\"+n))}function Me(e,t){return e=l({children:void 0},t),(t=function(e){var t=\"\";return r.Children.forEach(e,(function(e){null!=e&&(t+=e)})),t}(t.children))&&(e.children=t),e}function Re(e,t,n,r){if(e=e.options,t){t={};for(var l=0;l<n.length;l++)t[\"$\"+n[l]]=!0;for(n=0;n<e.length;n++)l=t.hasOwnProperty(\"$\"+e[n].value),e[n].selected!==l&&(e[n].selected=l),l&&r&&(e[n].defaultSelected=!0)}else{for(n=\"\"+ke(n),t=null,l=0;l<e.length;l++){if(e[l].value===n)return e[l].selected=!0,void(r&&(e[l].defaultSelected=!0));null!==t||e[l].disabled||(t=e[l])}null!==t&&(t.selected=!0)}}function Ie(e,t){if(null!=t.dangerouslySetInnerHTML)throw Error(a(91));return l({},t,{value:void 0,defaultValue:void 0,children:\"\"+e._wrapperState.initialValue})}function Fe(e,t){var n=t.value;if(null==n){if(n=t.defaultValue,null!=(t=t.children)){if(null!=n)throw Error(a(92));if(Array.isArray(t)){if(!(1>=t.length))throw Error(a(93));t=t[0]}n=t}null==n&&(n=\"\")}e._wrapperState={initialValue:ke(n)}}function Ue(e,t){var n=ke(t.value),r=ke(t.defaultValue);null!=n&&((n=\"\"+n)!==e.value&&(e.value=n),null==t.defaultValue&&e.defaultValue!==n&&(e.defaultValue=n)),null!=r&&(e.defaultValue=\"\"+r)}function De(e){var t=e.textContent;t===e._wrapperState.initialValue&&\"\"!==t&&null!==t&&(e.value=t)}\"accent-height alignment-baseline arabic-form baseline-shift cap-height clip-path clip-rule color-interpolation color-interpolation-filters color-profile color-rendering dominant-baseline enable-background fill-opacity fill-rule flood-color flood-opacity font-family font-size font-size-adjust font-stretch font-style font-variant font-weight glyph-name glyph-orientation-horizontal glyph-orientation-vertical horiz-adv-x horiz-origin-x image-rendering letter-spacing lighting-color marker-end marker-mid marker-start overline-position overline-thickness paint-order panose-1 pointer-events rendering-intent shape-rendering stop-color stop-opacity strikethrough-position strikethrough-thickness stroke-dasharray stroke-dashoffset stroke-linecap stroke-linejoin stroke-miterlimit stroke-opacity stroke-width text-anchor text-decoration text-rendering underline-position underline-thickness unicode-bidi unicode-range units-per-em v-alphabetic v-hanging v-ideographic v-mathematical vector-effect vert-adv-y vert-origin-x vert-origin-y word-spacing writing-mode xmlns:xlink x-height\".split(\" \").forEach((function(e){var t=e.replace(be,we);ge[t]=new ve(t,1,!1,e,null,!1)})),\"xlink:actuate xlink:arcrole xlink:role xlink:show xlink:title xlink:type\".split(\" \").forEach((function(e){var t=e.replace(be,we);ge[t]=new ve(t,1,!1,e,\"http://www.w3.org/1999/xlink\",!1)})),[\"xml:base\",\"xml:lang\",\"xml:space\"].forEach((function(e){var t=e.replace(be,we);ge[t]=new ve(t,1,!1,e,\"http://www.w3.org/XML/1998/namespace\",!1)})),[\"tabIndex\",\"crossOrigin\"].forEach((function(e){ge[e]=new ve(e,1,!1,e.toLowerCase(),null,!1)})),ge.xlinkHref=new ve(\"xlinkHref\",1,!1,\"xlink:href\",\"http://www.w3.org/1999/xlink\",!0),[\"src\",\"href\",\"action\",\"formAction\"].forEach((function(e){ge[e]=new ve(e,1,!1,e.toLowerCase(),null,!0)}));var Le=\"http://www.w3.org/1999/xhtml\",je=\"http://www.w3.org/2000/svg\";function Ae(e){switch(e){case\"svg\":return\"http://www.w3.org/2000/svg\";case\"math\":return\"http://www.w3.org/1998/Math/MathML\";default:return\"http://www.w3.org/1999/xhtml\"}}function Ve(e,t){return null==e||\"http://www.w3.org/1999/xhtml\"===e?Ae(t):\"http://www.w3.org/2000/svg\"===e&&\"foreignObject\"===t?\"http://www.w3.org/1999/xhtml\":e}var We,$e=function(e){return\"undefined\"!==typeof MSApp&&MSApp.execUnsafeLocalFunction?function(t,n,r,l){MSApp.execUnsafeLocalFunction((function(){return e(t,n)}))}:e}((function(e,t){if(e.namespaceURI!==je||\"innerHTML\"in e)e.innerHTML=t;else{for((We=We||document.createElement(\"div\")).innerHTML=\"<svg>\"+t.valueOf().toString()+\"</svg>\",t=We.firstChild;e.firstChild;)e.removeChild(e.firstChild);for(;t.firstChild;)e.appendChild(t.firstChild)}}));function Be(e,t){if(t){var n=e.firstChild;if(n&&n===e.lastChild&&3===n.nodeType)return void(n.nodeValue=t)}e.textContent=t}function He(e,t){var n={};return n[e.toLowerCase()]=t.toLowerCase(),n[\"Webkit\"+e]=\"webkit\"+t,n[\"Moz\"+e]=\"moz\"+t,n}var Qe={animationend:He(\"Animation\",\"AnimationEnd\"),animationiteration:He(\"Animation\",\"AnimationIteration\"),animationstart:He(\"Animation\",\"AnimationStart\"),transitionend:He(\"Transition\",\"TransitionEnd\")},Ke={},qe={};function Ye(e){if(Ke[e])return Ke[e];if(!Qe[e])return e;var t,n=Qe[e];for(t in n)if(n.hasOwnProperty(t)&&t in qe)return Ke[e]=n[t];return e}Z&&(qe=document.createElement(\"div\").style,\"AnimationEvent\"in window||(delete Qe.animationend.animation,delete Qe.animationiteration.animation,delete Qe.animationstart.animation),\"TransitionEvent\"in window||delete Qe.transitionend.transition);var Xe=Ye(\"animationend\"),Ge=Ye(\"animationiteration\"),Je=Ye(\"animationstart\"),Ze=Ye(\"transitionend\"),et=\"abort canplay canplaythrough durationchange emptied encrypted ended error loadeddata loadedmetadata loadstart pause play playing progress ratechange seeked seeking stalled suspend timeupdate volumechange waiting\".split(\" \");function tt(e){var t=e,n=e;if(e.alternate)for(;t.return;)t=t.return;else{e=t;do{0!==(1026&(t=e).effectTag)&&(n=t.return),e=t.return}while(e)}return 3===t.tag?n:null}function nt(e){if(13===e.tag){var t=e.memoizedState;if(null===t&&(null!==(e=e.alternate)&&(t=e.memoizedState)),null!==t)return t.dehydrated}return null}function rt(e){if(tt(e)!==e)throw Error(a(188))}function lt(e){if(!(e=function(e){var t=e.alternate;if(!t){if(null===(t=tt(e)))throw Error(a(188));return t!==e?null:e}for(var n=e,r=t;;){var l=n.return;if(null===l)break;var i=l.alternate;if(null===i){if(null!==(r=l.return)){n=r;continue}break}if(l.child===i.child){for(i=l.child;i;){if(i===n)return rt(l),e;if(i===r)return rt(l),t;i=i.sibling}throw Error(a(188))}if(n.return!==r.return)n=l,r=i;else{for(var o=!1,u=l.child;u;){if(u===n){o=!0,n=l,r=i;break}if(u===r){o=!0,r=l,n=i;break}u=u.sibling}if(!o){for(u=i.child;u;){if(u===n){o=!0,n=i,r=l;break}if(u===r){o=!0,r=i,n=l;break}u=u.sibling}if(!o)throw Error(a(189))}}if(n.alternate!==r)throw Error(a(190))}if(3!==n.tag)throw Error(a(188));return n.stateNode.current===n?e:t}(e)))return null;for(var t=e;;){if(5===t.tag||6===t.tag)return t;if(t.child)t.child.return=t,t=t.child;else{if(t===e)break;for(;!t.sibling;){if(!t.return||t.return===e)return null;t=t.return}t.sibling.return=t.return,t=t.sibling}}return null}var it,at,ot,ut=!1,ct=[],st=null,ft=null,dt=null,pt=new Map,mt=new Map,ht=[],yt=\"mousedown mouseup touchcancel touchend touchstart auxclick dblclick pointercancel pointerdown pointerup dragend dragstart drop compositionend compositionstart keydown keypress keyup input textInput close cancel copy cut paste click change contextmenu reset submit\".split(\" \"),vt=\"focus blur dragenter dragleave mouseover mouseout pointerover pointerout gotpointercapture lostpointercapture\".split(\" \");function gt(e,t,n,r){return{blockedOn:e,topLevelType:t,eventSystemFlags:32|n,nativeEvent:r}}function bt(e,t){switch(e){case\"focus\":case\"blur\":st=null;break;case\"dragenter\":case\"dragleave\":ft=null;break;case\"mouseover\":case\"mouseout\":dt=null;break;case\"pointerover\":case\"pointerout\":pt.delete(t.pointerId);break;case\"gotpointercapture\":case\"lostpointercapture\":mt.delete(t.pointerId)}}function wt(e,t,n,r,l){return null===e||e.nativeEvent!==l?(e=gt(t,n,r,l),null!==t&&(null!==(t=cr(t))&&at(t)),e):(e.eventSystemFlags|=r,e)}function kt(e){var t=ur(e.target);if(null!==t){var n=tt(t);if(null!==n)if(13===(t=n.tag)){if(null!==(t=nt(n)))return e.blockedOn=t,void i.unstable_runWithPriority(e.priority,(function(){ot(n)}))}else if(3===t&&n.stateNode.hydrate)return void(e.blockedOn=3===n.tag?n.stateNode.containerInfo:null)}e.blockedOn=null}function Et(e){if(null!==e.blockedOn)return!1;var t=zn(e.topLevelType,e.eventSystemFlags,e.nativeEvent);if(null!==t){var n=cr(t);return null!==n&&at(n),e.blockedOn=t,!1}return!0}function xt(e,t,n){Et(e)&&n.delete(t)}function Tt(){for(ut=!1;0<ct.length;){var e=ct[0];if(null!==e.blockedOn){null!==(e=cr(e.blockedOn))&&it(e);break}var t=zn(e.topLevelType,e.eventSystemFlags,e.nativeEvent);null!==t?e.blockedOn=t:ct.shift()}null!==st&&Et(st)&&(st=null),null!==ft&&Et(ft)&&(ft=null),null!==dt&&Et(dt)&&(dt=null),pt.forEach(xt),mt.forEach(xt)}function St(e,t){e.blockedOn===t&&(e.blockedOn=null,ut||(ut=!0,i.unstable_scheduleCallback(i.unstable_NormalPriority,Tt)))}function Ct(e){function t(t){return St(t,e)}if(0<ct.length){St(ct[0],e);for(var n=1;n<ct.length;n++){var r=ct[n];r.blockedOn===e&&(r.blockedOn=null)}}for(null!==st&&St(st,e),null!==ft&&St(ft,e),null!==dt&&St(dt,e),pt.forEach(t),mt.forEach(t),n=0;n<ht.length;n++)(r=ht[n]).blockedOn===e&&(r.blockedOn=null);for(;0<ht.length&&null===(n=ht[0]).blockedOn;)kt(n),null===n.blockedOn&&ht.shift()}function _t(e){return(e=e.target||e.srcElement||window).correspondingUseElement&&(e=e.correspondingUseElement),3===e.nodeType?e.parentNode:e}function Pt(e){do{e=e.return}while(e&&5!==e.tag);return e||null}function Nt(e,t,n){(t=M(e,n.dispatchConfig.phasedRegistrationNames[t]))&&(n._dispatchListeners=C(n._dispatchListeners,t),n._dispatchInstances=C(n._dispatchInstances,e))}function Ot(e){if(e&&e.dispatchConfig.phasedRegistrationNames){for(var t=e._targetInst,n=[];t;)n.push(t),t=Pt(t);for(t=n.length;0<t--;)Nt(n[t],\"captured\",e);for(t=0;t<n.length;t++)Nt(n[t],\"bubbled\",e)}}function zt(e,t,n){e&&n&&n.dispatchConfig.registrationName&&(t=M(e,n.dispatchConfig.registrationName))&&(n._dispatchListeners=C(n._dispatchListeners,t),n._dispatchInstances=C(n._dispatchInstances,e))}function Mt(e){e&&e.dispatchConfig.registrationName&&zt(e._targetInst,null,e)}function Rt(e){_(e,Ot)}function It(){return!0}function Ft(){return!1}function Ut(e,t,n,r){for(var l in this.dispatchConfig=e,this._targetInst=t,this.nativeEvent=n,e=this.constructor.Interface)e.hasOwnProperty(l)&&((t=e[l])?this[l]=t(n):\"target\"===l?this.target=r:this[l]=n[l]);return this.isDefaultPrevented=(null!=n.defaultPrevented?n.defaultPrevented:!1===n.returnValue)?It:Ft,this.isPropagationStopped=Ft,this}function Dt(e,t,n,r){if(this.eventPool.length){var l=this.eventPool.pop();return this.call(l,e,t,n,r),l}return new this(e,t,n,r)}function Lt(e){if(!(e instanceof this))throw Error(a(279));e.destructor(),10>this.eventPool.length&&this.eventPool.push(e)}function jt(e){e.eventPool=[],e.getPooled=Dt,e.release=Lt}l(Ut.prototype,{preventDefault:function(){this.defaultPrevented=!0;var e=this.nativeEvent;e&&(e.preventDefault?e.preventDefault():\"unknown\"!==typeof e.returnValue&&(e.returnValue=!1),this.isDefaultPrevented=It)},stopPropagation:function(){var e=this.nativeEvent;e&&(e.stopPropagation?e.stopPropagation():\"unknown\"!==typeof e.cancelBubble&&(e.cancelBubble=!0),this.isPropagationStopped=It)},persist:function(){this.isPersistent=It},isPersistent:Ft,destructor:function(){var e,t=this.constructor.Interface;for(e in t)this[e]=null;this.nativeEvent=this._targetInst=this.dispatchConfig=null,this.isPropagationStopped=this.isDefaultPrevented=Ft,this._dispatchInstances=this._dispatchListeners=null}}),Ut.Interface={type:null,target:null,currentTarget:function(){return null},eventPhase:null,bubbles:null,cancelable:null,timeStamp:function(e){return e.timeStamp||Date.now()},defaultPrevented:null,isTrusted:null},Ut.extend=function(e){function t(){}function n(){return r.apply(this,arguments)}var r=this;t.prototype=r.prototype;var i=new t;return l(i,n.prototype),n.prototype=i,n.prototype.constructor=n,n.Interface=l({},r.Interface,e),n.extend=r.extend,jt(n),n},jt(Ut);var At=Ut.extend({animationName:null,elapsedTime:null,pseudoElement:null}),Vt=Ut.extend({clipboardData:function(e){return\"clipboardData\"in e?e.clipboardData:window.clipboardData}}),Wt=Ut.extend({view:null,detail:null}),$t=Wt.extend({relatedTarget:null});function Bt(e){var t=e.keyCode;return\"charCode\"in e?0===(e=e.charCode)&&13===t&&(e=13):e=t,10===e&&(e=13),32<=e||13===e?e:0}var Ht={Esc:\"Escape\",Spacebar:\" \",Left:\"ArrowLeft\",Up:\"ArrowUp\",Right:\"ArrowRight\",Down:\"ArrowDown\",Del:\"Delete\",Win:\"OS\",Menu:\"ContextMenu\",Apps:\"ContextMenu\",Scroll:\"ScrollLock\",MozPrintableKey:\"Unidentified\"},Qt={8:\"Backspace\",9:\"Tab\",12:\"Clear\",13:\"Enter\",16:\"Shift\",17:\"Control\",18:\"Alt\",19:\"Pause\",20:\"CapsLock\",27:\"Escape\",32:\" \",33:\"PageUp\",34:\"PageDown\",35:\"End\",36:\"Home\",37:\"ArrowLeft\",38:\"ArrowUp\",39:\"ArrowRight\",40:\"ArrowDown\",45:\"Insert\",46:\"Delete\",112:\"F1\",113:\"F2\",114:\"F3\",115:\"F4\",116:\"F5\",117:\"F6\",118:\"F7\",119:\"F8\",120:\"F9\",121:\"F10\",122:\"F11\",123:\"F12\",144:\"NumLock\",145:\"ScrollLock\",224:\"Meta\"},Kt={Alt:\"altKey\",Control:\"ctrlKey\",Meta:\"metaKey\",Shift:\"shiftKey\"};function qt(e){var t=this.nativeEvent;return t.getModifierState?t.getModifierState(e):!!(e=Kt[e])&&!!t[e]}function Yt(){return qt}for(var Xt=Wt.extend({key:function(e){if(e.key){var t=Ht[e.key]||e.key;if(\"Unidentified\"!==t)return t}return\"keypress\"===e.type?13===(e=Bt(e))?\"Enter\":String.fromCharCode(e):\"keydown\"===e.type||\"keyup\"===e.type?Qt[e.keyCode]||\"Unidentified\":\"\"},location:null,ctrlKey:null,shiftKey:null,altKey:null,metaKey:null,repeat:null,locale:null,getModifierState:Yt,charCode:function(e){return\"keypress\"===e.type?Bt(e):0},keyCode:function(e){return\"keydown\"===e.type||\"keyup\"===e.type?e.keyCode:0},which:function(e){return\"keypress\"===e.type?Bt(e):\"keydown\"===e.type||\"keyup\"===e.type?e.keyCode:0}}),Gt=0,Jt=0,Zt=!1,en=!1,tn=Wt.extend({screenX:null,screenY:null,clientX:null,clientY:null,pageX:null,pageY:null,ctrlKey:null,shiftKey:null,altKey:null,metaKey:null,getModifierState:Yt,button:null,buttons:null,relatedTarget:function(e){return e.relatedTarget||(e.fromElement===e.srcElement?e.toElement:e.fromElement)},movementX:function(e){if(\"movementX\"in e)return e.movementX;var t=Gt;return Gt=e.screenX,Zt?\"mousemove\"===e.type?e.screenX-t:0:(Zt=!0,0)},movementY:function(e){if(\"movementY\"in e)return e.movementY;var t=Jt;return Jt=e.screenY,en?\"mousemove\"===e.type?e.screenY-t:0:(en=!0,0)}}),nn=tn.extend({pointerId:null,width:null,height:null,pressure:null,tangentialPressure:null,tiltX:null,tiltY:null,twist:null,pointerType:null,isPrimary:null}),rn=tn.extend({dataTransfer:null}),ln=Wt.extend({touches:null,targetTouches:null,changedTouches:null,altKey:null,metaKey:null,ctrlKey:null,shiftKey:null,getModifierState:Yt}),an=Ut.extend({propertyName:null,elapsedTime:null,pseudoElement:null}),on=tn.extend({deltaX:function(e){return\"deltaX\"in e?e.deltaX:\"wheelDeltaX\"in e?-e.wheelDeltaX:0},deltaY:function(e){return\"deltaY\"in e?e.deltaY:\"wheelDeltaY\"in e?-e.wheelDeltaY:\"wheelDelta\"in e?-e.wheelDelta:0},deltaZ:null,deltaMode:null}),un=[[\"blur\",\"blur\",0],[\"cancel\",\"cancel\",0],[\"click\",\"click\",0],[\"close\",\"close\",0],[\"contextmenu\",\"contextMenu\",0],[\"copy\",\"copy\",0],[\"cut\",\"cut\",0],[\"auxclick\",\"auxClick\",0],[\"dblclick\",\"doubleClick\",0],[\"dragend\",\"dragEnd\",0],[\"dragstart\",\"dragStart\",0],[\"drop\",\"drop\",0],[\"focus\",\"focus\",0],[\"input\",\"input\",0],[\"invalid\",\"invalid\",0],[\"keydown\",\"keyDown\",0],[\"keypress\",\"keyPress\",0],[\"keyup\",\"keyUp\",0],[\"mousedown\",\"mouseDown\",0],[\"mouseup\",\"mouseUp\",0],[\"paste\",\"paste\",0],[\"pause\",\"pause\",0],[\"play\",\"play\",0],[\"pointercancel\",\"pointerCancel\",0],[\"pointerdown\",\"pointerDown\",0],[\"pointerup\",\"pointerUp\",0],[\"ratechange\",\"rateChange\",0],[\"reset\",\"reset\",0],[\"seeked\",\"seeked\",0],[\"submit\",\"submit\",0],[\"touchcancel\",\"touchCancel\",0],[\"touchend\",\"touchEnd\",0],[\"touchstart\",\"touchStart\",0],[\"volumechange\",\"volumeChange\",0],[\"drag\",\"drag\",1],[\"dragenter\",\"dragEnter\",1],[\"dragexit\",\"dragExit\",1],[\"dragleave\",\"dragLeave\",1],[\"dragover\",\"dragOver\",1],[\"mousemove\",\"mouseMove\",1],[\"mouseout\",\"mouseOut\",1],[\"mouseover\",\"mouseOver\",1],[\"pointermove\",\"pointerMove\",1],[\"pointerout\",\"pointerOut\",1],[\"pointerover\",\"pointerOver\",1],[\"scroll\",\"scroll\",1],[\"toggle\",\"toggle\",1],[\"touchmove\",\"touchMove\",1],[\"wheel\",\"wheel\",1],[\"abort\",\"abort\",2],[Xe,\"animationEnd\",2],[Ge,\"animationIteration\",2],[Je,\"animationStart\",2],[\"canplay\",\"canPlay\",2],[\"canplaythrough\",\"canPlayThrough\",2],[\"durationchange\",\"durationChange\",2],[\"emptied\",\"emptied\",2],[\"encrypted\",\"encrypted\",2],[\"ended\",\"ended\",2],[\"error\",\"error\",2],[\"gotpointercapture\",\"gotPointerCapture\",2],[\"load\",\"load\",2],[\"loadeddata\",\"loadedData\",2],[\"loadedmetadata\",\"loadedMetadata\",2],[\"loadstart\",\"loadStart\",2],[\"lostpointercapture\",\"lostPointerCapture\",2],[\"playing\",\"playing\",2],[\"progress\",\"progress\",2],[\"seeking\",\"seeking\",2],[\"stalled\",\"stalled\",2],[\"suspend\",\"suspend\",2],[\"timeupdate\",\"timeUpdate\",2],[Ze,\"transitionEnd\",2],[\"waiting\",\"waiting\",2]],cn={},sn={},fn=0;fn<un.length;fn++){var dn=un[fn],pn=dn[0],mn=dn[1],hn=dn[2],yn=\"on\"+(mn[0].toUpperCase()+mn.slice(1)),vn={phasedRegistrationNames:{bubbled:yn,captured:yn+\"Capture\"},dependencies:[pn],eventPriority:hn};cn[mn]=vn,sn[pn]=vn}var gn={eventTypes:cn,getEventPriority:function(e){return void 0!==(e=sn[e])?e.eventPriority:2},extractEvents:function(e,t,n,r){var l=sn[e];if(!l)return null;switch(e){case\"keypress\":if(0===Bt(n))return null;case\"keydown\":case\"keyup\":e=Xt;break;case\"blur\":case\"focus\":e=$t;break;case\"click\":if(2===n.button)return null;case\"auxclick\":case\"dblclick\":case\"mousedown\":case\"mousemove\":case\"mouseup\":case\"mouseout\":case\"mouseover\":case\"contextmenu\":e=tn;break;case\"drag\":case\"dragend\":case\"dragenter\":case\"dragexit\":case\"dragleave\":case\"dragover\":case\"dragstart\":case\"drop\":e=rn;break;case\"touchcancel\":case\"touchend\":case\"touchmove\":case\"touchstart\":e=ln;break;case Xe:case Ge:case Je:e=At;break;case Ze:e=an;break;case\"scroll\":e=Wt;break;case\"wheel\":e=on;break;case\"copy\":case\"cut\":case\"paste\":e=Vt;break;case\"gotpointercapture\":case\"lostpointercapture\":case\"pointercancel\":case\"pointerdown\":case\"pointermove\":case\"pointerout\":case\"pointerover\":case\"pointerup\":e=nn;break;default:e=Ut}return Rt(t=e.getPooled(l,t,n,r)),t}},bn=i.unstable_UserBlockingPriority,wn=i.unstable_runWithPriority,kn=gn.getEventPriority,En=[];function xn(e){var t=e.targetInst,n=t;do{if(!n){e.ancestors.push(n);break}var r=n;if(3===r.tag)r=r.stateNode.containerInfo;else{for(;r.return;)r=r.return;r=3!==r.tag?null:r.stateNode.containerInfo}if(!r)break;5!==(t=n.tag)&&6!==t||e.ancestors.push(n),n=ur(r)}while(n);for(n=0;n<e.ancestors.length;n++){t=e.ancestors[n];var l=_t(e.nativeEvent);r=e.topLevelType;for(var i=e.nativeEvent,a=e.eventSystemFlags,o=null,u=0;u<f.length;u++){var c=f[u];c&&(c=c.extractEvents(r,t,i,l,a))&&(o=C(o,c))}O(o)}}var Tn=!0;function Sn(e,t){Cn(t,e,!1)}function Cn(e,t,n){switch(kn(t)){case 0:var r=_n.bind(null,t,1);break;case 1:r=Pn.bind(null,t,1);break;default:r=On.bind(null,t,1)}n?e.addEventListener(t,r,!0):e.addEventListener(t,r,!1)}function _n(e,t,n){se||ue();var r=On,l=se;se=!0;try{oe(r,e,t,n)}finally{(se=l)||de()}}function Pn(e,t,n){wn(bn,On.bind(null,e,t,n))}function Nn(e,t,n,r){if(En.length){var l=En.pop();l.topLevelType=e,l.eventSystemFlags=t,l.nativeEvent=n,l.targetInst=r,e=l}else e={topLevelType:e,eventSystemFlags:t,nativeEvent:n,targetInst:r,ancestors:[]};try{if(t=xn,n=e,fe)t(n,void 0);else{fe=!0;try{ce(t,n,void 0)}finally{fe=!1,de()}}}finally{e.topLevelType=null,e.nativeEvent=null,e.targetInst=null,e.ancestors.length=0,En.length<10&&En.push(e)}}function On(e,t,n){if(Tn)if(0<ct.length&&-1<yt.indexOf(e))e=gt(null,e,t,n),ct.push(e);else{var r=zn(e,t,n);null===r?bt(e,n):-1<yt.indexOf(e)?(e=gt(r,e,t,n),ct.push(e)):function(e,t,n,r){switch(t){case\"focus\":return st=wt(st,e,t,n,r),!0;case\"dragenter\":return ft=wt(ft,e,t,n,r),!0;case\"mouseover\":return dt=wt(dt,e,t,n,r),!0;case\"pointerover\":var l=r.pointerId;return pt.set(l,wt(pt.get(l)||null,e,t,n,r)),!0;case\"gotpointercapture\":return l=r.pointerId,mt.set(l,wt(mt.get(l)||null,e,t,n,r)),!0}return!1}(r,e,t,n)||(bt(e,n),Nn(e,t,n,null))}}function zn(e,t,n){var r=_t(n);if(null!==(r=ur(r))){var l=tt(r);if(null===l)r=null;else{var i=l.tag;if(13===i){if(null!==(r=nt(l)))return r;r=null}else if(3===i){if(l.stateNode.hydrate)return 3===l.tag?l.stateNode.containerInfo:null;r=null}else l!==r&&(r=null)}}return Nn(e,t,n,r),null}function Mn(e){if(!Z)return!1;var t=(e=\"on\"+e)in document;return t||((t=document.createElement(\"div\")).setAttribute(e,\"return;\"),t=\"function\"===typeof t[e]),t}var Rn=new(\"function\"===typeof WeakMap?WeakMap:Map);function In(e){var t=Rn.get(e);return void 0===t&&(t=new Set,Rn.set(e,t)),t}function Fn(e,t,n){if(!n.has(e)){switch(e){case\"scroll\":Cn(t,\"scroll\",!0);break;case\"focus\":case\"blur\":Cn(t,\"focus\",!0),Cn(t,\"blur\",!0),n.add(\"blur\"),n.add(\"focus\");break;case\"cancel\":case\"close\":Mn(e)&&Cn(t,e,!0);break;case\"invalid\":case\"submit\":case\"reset\":break;default:-1===et.indexOf(e)&&Sn(e,t)}n.add(e)}}var Un={animationIterationCount:!0,borderImageOutset:!0,borderImageSlice:!0,borderImageWidth:!0,boxFlex:!0,boxFlexGroup:!0,boxOrdinalGroup:!0,columnCount:!0,columns:!0,flex:!0,flexGrow:!0,flexPositive:!0,flexShrink:!0,flexNegative:!0,flexOrder:!0,gridArea:!0,gridRow:!0,gridRowEnd:!0,gridRowSpan:!0,gridRowStart:!0,gridColumn:!0,gridColumnEnd:!0,gridColumnSpan:!0,gridColumnStart:!0,fontWeight:!0,lineClamp:!0,lineHeight:!0,opacity:!0,order:!0,orphans:!0,tabSize:!0,widows:!0,zIndex:!0,zoom:!0,fillOpacity:!0,floodOpacity:!0,stopOpacity:!0,strokeDasharray:!0,strokeDashoffset:!0,strokeMiterlimit:!0,strokeOpacity:!0,strokeWidth:!0},Dn=[\"Webkit\",\"ms\",\"Moz\",\"O\"];function Ln(e,t,n){return null==t||\"boolean\"===typeof t||\"\"===t?\"\":n||\"number\"!==typeof t||0===t||Un.hasOwnProperty(e)&&Un[e]?(\"\"+t).trim():t+\"px\"}function jn(e,t){for(var n in e=e.style,t)if(t.hasOwnProperty(n)){var r=0===n.indexOf(\"--\"),l=Ln(n,t[n],r);\"float\"===n&&(n=\"cssFloat\"),r?e.setProperty(n,l):e[n]=l}}Object.keys(Un).forEach((function(e){Dn.forEach((function(t){t=t+e.charAt(0).toUpperCase()+e.substring(1),Un[t]=Un[e]}))}));var An=l({menuitem:!0},{area:!0,base:!0,br:!0,col:!0,embed:!0,hr:!0,img:!0,input:!0,keygen:!0,link:!0,meta:!0,param:!0,source:!0,track:!0,wbr:!0});function Vn(e,t){if(t){if(An[e]&&(null!=t.children||null!=t.dangerouslySetInnerHTML))throw Error(a(137,e,\"\"));if(null!=t.dangerouslySetInnerHTML){if(null!=t.children)throw Error(a(60));if(!(\"object\"===typeof t.dangerouslySetInnerHTML&&\"__html\"in t.dangerouslySetInnerHTML))throw Error(a(61))}if(null!=t.style&&\"object\"!==typeof t.style)throw Error(a(62,\"\"))}}function Wn(e,t){if(-1===e.indexOf(\"-\"))return\"string\"===typeof t.is;switch(e){case\"annotation-xml\":case\"color-profile\":case\"font-face\":case\"font-face-src\":case\"font-face-uri\":case\"font-face-format\":case\"font-face-name\":case\"missing-glyph\":return!1;default:return!0}}function $n(e,t){var n=In(e=9===e.nodeType||11===e.nodeType?e:e.ownerDocument);t=m[t];for(var r=0;r<t.length;r++)Fn(t[r],e,n)}function Bn(){}function Hn(e){if(\"undefined\"===typeof(e=e||(\"undefined\"!==typeof document?document:void 0)))return null;try{return e.activeElement||e.body}catch(t){return e.body}}function Qn(e){for(;e&&e.firstChild;)e=e.firstChild;return e}function Kn(e,t){var n,r=Qn(e);for(e=0;r;){if(3===r.nodeType){if(n=e+r.textContent.length,e<=t&&n>=t)return{node:r,offset:t-e};e=n}e:{for(;r;){if(r.nextSibling){r=r.nextSibling;break e}r=r.parentNode}r=void 0}r=Qn(r)}}function qn(){for(var e=window,t=Hn();t instanceof e.HTMLIFrameElement;){try{var n=\"string\"===typeof t.contentWindow.location.href}catch(r){n=!1}if(!n)break;t=Hn((e=t.contentWindow).document)}return t}function Yn(e){var t=e&&e.nodeName&&e.nodeName.toLowerCase();return t&&(\"input\"===t&&(\"text\"===e.type||\"search\"===e.type||\"tel\"===e.type||\"url\"===e.type||\"password\"===e.type)||\"textarea\"===t||\"true\"===e.contentEditable)}var Xn=null,Gn=null;function Jn(e,t){switch(e){case\"button\":case\"input\":case\"select\":case\"textarea\":return!!t.autoFocus}return!1}function Zn(e,t){return\"textarea\"===e||\"option\"===e||\"noscript\"===e||\"string\"===typeof t.children||\"number\"===typeof t.children||\"object\"===typeof t.dangerouslySetInnerHTML&&null!==t.dangerouslySetInnerHTML&&null!=t.dangerouslySetInnerHTML.__html}var er=\"function\"===typeof setTimeout?setTimeout:void 0,tr=\"function\"===typeof clearTimeout?clearTimeout:void 0;function nr(e){for(;null!=e;e=e.nextSibling){var t=e.nodeType;if(1===t||3===t)break}return e}function rr(e){e=e.previousSibling;for(var t=0;e;){if(8===e.nodeType){var n=e.data;if(\"$\"===n||\"$!\"===n||\"$?\"===n){if(0===t)return e;t--}else\"/$\"===n&&t++}e=e.previousSibling}return null}var lr=Math.random().toString(36).slice(2),ir=\"__reactInternalInstance$\"+lr,ar=\"__reactEventHandlers$\"+lr,or=\"__reactContainere$\"+lr;function ur(e){var t=e[ir];if(t)return t;for(var n=e.parentNode;n;){if(t=n[or]||n[ir]){if(n=t.alternate,null!==t.child||null!==n&&null!==n.child)for(e=rr(e);null!==e;){if(n=e[ir])return n;e=rr(e)}return t}n=(e=n).parentNode}return null}function cr(e){return!(e=e[ir]||e[or])||5!==e.tag&&6!==e.tag&&13!==e.tag&&3!==e.tag?null:e}function sr(e){if(5===e.tag||6===e.tag)return e.stateNode;throw Error(a(33))}function fr(e){return e[ar]||null}var dr=null,pr=null,mr=null;function hr(){if(mr)return mr;var e,t,n=pr,r=n.length,l=\"value\"in dr?dr.value:dr.textContent,i=l.length;for(e=0;e<r&&n[e]===l[e];e++);var a=r-e;for(t=1;t<=a&&n[r-t]===l[i-t];t++);return mr=l.slice(e,1<t?1-t:void 0)}var yr=Ut.extend({data:null}),vr=Ut.extend({data:null}),gr=[9,13,27,32],br=Z&&\"CompositionEvent\"in window,wr=null;Z&&\"documentMode\"in document&&(wr=document.documentMode);var kr=Z&&\"TextEvent\"in window&&!wr,Er=Z&&(!br||wr&&8<wr&&11>=wr),xr=String.fromCharCode(32),Tr={beforeInput:{phasedRegistrationNames:{bubbled:\"onBeforeInput\",captured:\"onBeforeInputCapture\"},dependencies:[\"compositionend\",\"keypress\",\"textInput\",\"paste\"]},compositionEnd:{phasedRegistrationNames:{bubbled:\"onCompositionEnd\",captured:\"onCompositionEndCapture\"},dependencies:\"blur compositionend keydown keypress keyup mousedown\".split(\" \")},compositionStart:{phasedRegistrationNames:{bubbled:\"onCompositionStart\",captured:\"onCompositionStartCapture\"},dependencies:\"blur compositionstart keydown keypress keyup mousedown\".split(\" \")},compositionUpdate:{phasedRegistrationNames:{bubbled:\"onCompositionUpdate\",captured:\"onCompositionUpdateCapture\"},dependencies:\"blur compositionupdate keydown keypress keyup mousedown\".split(\" \")}},Sr=!1;function Cr(e,t){switch(e){case\"keyup\":return-1!==gr.indexOf(t.keyCode);case\"keydown\":return 229!==t.keyCode;case\"keypress\":case\"mousedown\":case\"blur\":return!0;default:return!1}}function _r(e){return\"object\"===typeof(e=e.detail)&&\"data\"in e?e.data:null}var Pr=!1;var Nr={eventTypes:Tr,extractEvents:function(e,t,n,r){var l;if(br)e:{switch(e){case\"compositionstart\":var i=Tr.compositionStart;break e;case\"compositionend\":i=Tr.compositionEnd;break e;case\"compositionupdate\":i=Tr.compositionUpdate;break e}i=void 0}else Pr?Cr(e,n)&&(i=Tr.compositionEnd):\"keydown\"===e&&229===n.keyCode&&(i=Tr.compositionStart);return i?(Er&&\"ko\"!==n.locale&&(Pr||i!==Tr.compositionStart?i===Tr.compositionEnd&&Pr&&(l=hr()):(pr=\"value\"in(dr=r)?dr.value:dr.textContent,Pr=!0)),i=yr.getPooled(i,t,n,r),l?i.data=l:null!==(l=_r(n))&&(i.data=l),Rt(i),l=i):l=null,(e=kr?function(e,t){switch(e){case\"compositionend\":return _r(t);case\"keypress\":return 32!==t.which?null:(Sr=!0,xr);case\"textInput\":return(e=t.data)===xr&&Sr?null:e;default:return null}}(e,n):function(e,t){if(Pr)return\"compositionend\"===e||!br&&Cr(e,t)?(e=hr(),mr=pr=dr=null,Pr=!1,e):null;switch(e){case\"paste\":return null;case\"keypress\":if(!(t.ctrlKey||t.altKey||t.metaKey)||t.ctrlKey&&t.altKey){if(t.char&&1<t.char.length)return t.char;if(t.which)return String.fromCharCode(t.which)}return null;case\"compositionend\":return Er&&\"ko\"!==t.locale?null:t.data;default:return null}}(e,n))?((t=vr.getPooled(Tr.beforeInput,t,n,r)).data=e,Rt(t)):t=null,null===l?t:null===t?l:[l,t]}},Or={color:!0,date:!0,datetime:!0,\"datetime-local\":!0,email:!0,month:!0,number:!0,password:!0,range:!0,search:!0,tel:!0,text:!0,time:!0,url:!0,week:!0};function zr(e){var t=e&&e.nodeName&&e.nodeName.toLowerCase();return\"input\"===t?!!Or[e.type]:\"textarea\"===t}var Mr={change:{phasedRegistrationNames:{bubbled:\"onChange\",captured:\"onChangeCapture\"},dependencies:\"blur change click focus input keydown keyup selectionchange\".split(\" \")}};function Rr(e,t,n){return(e=Ut.getPooled(Mr.change,e,t,n)).type=\"change\",le(n),Rt(e),e}var Ir=null,Fr=null;function Ur(e){O(e)}function Dr(e){if(Se(sr(e)))return e}function Lr(e,t){if(\"change\"===e)return t}var jr=!1;function Ar(){Ir&&(Ir.detachEvent(\"onpropertychange\",Vr),Fr=Ir=null)}function Vr(e){if(\"value\"===e.propertyName&&Dr(Fr))if(e=Rr(Fr,e,_t(e)),se)O(e);else{se=!0;try{ae(Ur,e)}finally{se=!1,de()}}}function Wr(e,t,n){\"focus\"===e?(Ar(),Fr=n,(Ir=t).attachEvent(\"onpropertychange\",Vr)):\"blur\"===e&&Ar()}function $r(e){if(\"selectionchange\"===e||\"keyup\"===e||\"keydown\"===e)return Dr(Fr)}function Br(e,t){if(\"click\"===e)return Dr(t)}function Hr(e,t){if(\"input\"===e||\"change\"===e)return Dr(t)}Z&&(jr=Mn(\"input\")&&(!document.documentMode||9<document.documentMode));var Qr,Kr={eventTypes:Mr,_isInputEventSupported:jr,extractEvents:function(e,t,n,r){var l=t?sr(t):window,i=l.nodeName&&l.nodeName.toLowerCase();if(\"select\"===i||\"input\"===i&&\"file\"===l.type)var a=Lr;else if(zr(l))if(jr)a=Hr;else{a=$r;var o=Wr}else(i=l.nodeName)&&\"input\"===i.toLowerCase()&&(\"checkbox\"===l.type||\"radio\"===l.type)&&(a=Br);if(a&&(a=a(e,t)))return Rr(a,n,r);o&&o(e,l,t),\"blur\"===e&&(e=l._wrapperState)&&e.controlled&&\"number\"===l.type&&ze(l,\"number\",l.value)}},qr={mouseEnter:{registrationName:\"onMouseEnter\",dependencies:[\"mouseout\",\"mouseover\"]},mouseLeave:{registrationName:\"onMouseLeave\",dependencies:[\"mouseout\",\"mouseover\"]},pointerEnter:{registrationName:\"onPointerEnter\",dependencies:[\"pointerout\",\"pointerover\"]},pointerLeave:{registrationName:\"onPointerLeave\",dependencies:[\"pointerout\",\"pointerover\"]}},Yr={eventTypes:qr,extractEvents:function(e,t,n,r,l){var i=\"mouseover\"===e||\"pointerover\"===e,a=\"mouseout\"===e||\"pointerout\"===e;if(i&&0===(32&l)&&(n.relatedTarget||n.fromElement)||!a&&!i)return null;if(l=r.window===r?r:(l=r.ownerDocument)?l.defaultView||l.parentWindow:window,a?(a=t,null!==(t=(t=n.relatedTarget||n.toElement)?ur(t):null)&&(t!==(i=tt(t))||5!==t.tag&&6!==t.tag)&&(t=null)):a=null,a===t)return null;if(\"mouseout\"===e||\"mouseover\"===e)var o=tn,u=qr.mouseLeave,c=qr.mouseEnter,s=\"mouse\";else\"pointerout\"!==e&&\"pointerover\"!==e||(o=nn,u=qr.pointerLeave,c=qr.pointerEnter,s=\"pointer\");if(e=null==a?l:sr(a),l=null==t?l:sr(t),(u=o.getPooled(u,a,n,r)).type=s+\"leave\",u.target=e,u.relatedTarget=l,(r=o.getPooled(c,t,n,r)).type=s+\"enter\",r.target=l,r.relatedTarget=e,s=t,(o=a)&&s)e:{for(e=s,a=0,t=c=o;t;t=Pt(t))a++;for(t=0,l=e;l;l=Pt(l))t++;for(;0<a-t;)c=Pt(c),a--;for(;0<t-a;)e=Pt(e),t--;for(;a--;){if(c===e||c===e.alternate)break e;c=Pt(c),e=Pt(e)}c=null}else c=null;for(e=c,c=[];o&&o!==e&&(null===(a=o.alternate)||a!==e);)c.push(o),o=Pt(o);for(o=[];s&&s!==e&&(null===(a=s.alternate)||a!==e);)o.push(s),s=Pt(s);for(s=0;s<c.length;s++)zt(c[s],\"bubbled\",u);for(s=o.length;0<s--;)zt(o[s],\"captured\",r);return n===Qr?(Qr=null,[u]):(Qr=n,[u,r])}};var Xr=\"function\"===typeof Object.is?Object.is:function(e,t){return e===t&&(0!==e||1/e===1/t)||e!==e&&t!==t},Gr=Object.prototype.hasOwnProperty;function Jr(e,t){if(Xr(e,t))return!0;if(\"object\"!==typeof e||null===e||\"object\"!==typeof t||null===t)return!1;var n=Object.keys(e),r=Object.keys(t);if(n.length!==r.length)return!1;for(r=0;r<n.length;r++)if(!Gr.call(t,n[r])||!Xr(e[n[r]],t[n[r]]))return!1;return!0}var Zr=Z&&\"documentMode\"in document&&11>=document.documentMode,el={select:{phasedRegistrationNames:{bubbled:\"onSelect\",captured:\"onSelectCapture\"},dependencies:\"blur contextmenu dragend focus keydown keyup mousedown mouseup selectionchange\".split(\" \")}},tl=null,nl=null,rl=null,ll=!1;function il(e,t){var n=t.window===t?t.document:9===t.nodeType?t:t.ownerDocument;return ll||null==tl||tl!==Hn(n)?null:(\"selectionStart\"in(n=tl)&&Yn(n)?n={start:n.selectionStart,end:n.selectionEnd}:n={anchorNode:(n=(n.ownerDocument&&n.ownerDocument.defaultView||window).getSelection()).anchorNode,anchorOffset:n.anchorOffset,focusNode:n.focusNode,focusOffset:n.focusOffset},rl&&Jr(rl,n)?null:(rl=n,(e=Ut.getPooled(el.select,nl,e,t)).type=\"select\",e.target=tl,Rt(e),e))}var al={eventTypes:el,extractEvents:function(e,t,n,r){var l,i=r.window===r?r.document:9===r.nodeType?r:r.ownerDocument;if(!(l=!i)){e:{i=In(i),l=m.onSelect;for(var a=0;a<l.length;a++)if(!i.has(l[a])){i=!1;break e}i=!0}l=!i}if(l)return null;switch(i=t?sr(t):window,e){case\"focus\":(zr(i)||\"true\"===i.contentEditable)&&(tl=i,nl=t,rl=null);break;case\"blur\":rl=nl=tl=null;break;case\"mousedown\":ll=!0;break;case\"contextmenu\":case\"mouseup\":case\"dragend\":return ll=!1,il(n,r);case\"selectionchange\":if(Zr)break;case\"keydown\":case\"keyup\":return il(n,r)}return null}};z.injectEventPluginOrder(\"ResponderEventPlugin SimpleEventPlugin EnterLeaveEventPlugin ChangeEventPlugin SelectEventPlugin BeforeInputEventPlugin\".split(\" \")),E=fr,x=cr,T=sr,z.injectEventPluginsByName({SimpleEventPlugin:gn,EnterLeaveEventPlugin:Yr,ChangeEventPlugin:Kr,SelectEventPlugin:al,BeforeInputEventPlugin:Nr}),new Set;var ol=[],ul=-1;function cl(e){0>ul||(e.current=ol[ul],ol[ul]=null,ul--)}function sl(e,t){ul++,ol[ul]=e.current,e.current=t}var fl={},dl={current:fl},pl={current:!1},ml=fl;function hl(e,t){var n=e.type.contextTypes;if(!n)return fl;var r=e.stateNode;if(r&&r.__reactInternalMemoizedUnmaskedChildContext===t)return r.__reactInternalMemoizedMaskedChildContext;var l,i={};for(l in n)i[l]=t[l];return r&&((e=e.stateNode).__reactInternalMemoizedUnmaskedChildContext=t,e.__reactInternalMemoizedMaskedChildContext=i),i}function yl(e){return null!==(e=e.childContextTypes)&&void 0!==e}function vl(e){cl(pl),cl(dl)}function gl(e){cl(pl),cl(dl)}function bl(e,t,n){if(dl.current!==fl)throw Error(a(168));sl(dl,t),sl(pl,n)}function wl(e,t,n){var r=e.stateNode;if(e=t.childContextTypes,\"function\"!==typeof r.getChildContext)return n;for(var i in r=r.getChildContext())if(!(i in e))throw Error(a(108,G(t)||\"Unknown\",i));return l({},n,{},r)}function kl(e){var t=e.stateNode;return t=t&&t.__reactInternalMemoizedMergedChildContext||fl,ml=dl.current,sl(dl,t),sl(pl,pl.current),!0}function El(e,t,n){var r=e.stateNode;if(!r)throw Error(a(169));n?(t=wl(e,t,ml),r.__reactInternalMemoizedMergedChildContext=t,cl(pl),cl(dl),sl(dl,t)):cl(pl),sl(pl,n)}var xl=i.unstable_runWithPriority,Tl=i.unstable_scheduleCallback,Sl=i.unstable_cancelCallback,Cl=i.unstable_shouldYield,_l=i.unstable_requestPaint,Pl=i.unstable_now,Nl=i.unstable_getCurrentPriorityLevel,Ol=i.unstable_ImmediatePriority,zl=i.unstable_UserBlockingPriority,Ml=i.unstable_NormalPriority,Rl=i.unstable_LowPriority,Il=i.unstable_IdlePriority,Fl={},Ul=void 0!==_l?_l:function(){},Dl=null,Ll=null,jl=!1,Al=Pl(),Vl=1e4>Al?Pl:function(){return Pl()-Al};function Wl(){switch(Nl()){case Ol:return 99;case zl:return 98;case Ml:return 97;case Rl:return 96;case Il:return 95;default:throw Error(a(332))}}function $l(e){switch(e){case 99:return Ol;case 98:return zl;case 97:return Ml;case 96:return Rl;case 95:return Il;default:throw Error(a(332))}}function Bl(e,t){return e=$l(e),xl(e,t)}function Hl(e,t,n){return e=$l(e),Tl(e,t,n)}function Ql(e){return null===Dl?(Dl=[e],Ll=Tl(Ol,ql)):Dl.push(e),Fl}function Kl(){if(null!==Ll){var e=Ll;Ll=null,Sl(e)}ql()}function ql(){if(!jl&&null!==Dl){jl=!0;var e=0;try{var t=Dl;Bl(99,(function(){for(;e<t.length;e++){var n=t[e];do{n=n(!0)}while(null!==n)}})),Dl=null}catch(n){throw null!==Dl&&(Dl=Dl.slice(e+1)),Tl(Ol,Kl),n}finally{jl=!1}}}var Yl=3;function Xl(e,t,n){return 1073741821-(1+((1073741821-e+t/10)/(n/=10)|0))*n}function Gl(e,t){if(e&&e.defaultProps)for(var n in t=l({},t),e=e.defaultProps)void 0===t[n]&&(t[n]=e[n]);return t}var Jl={current:null},Zl=null,ei=null,ti=null;function ni(){ti=ei=Zl=null}function ri(e,t){var n=e.type._context;sl(Jl,n._currentValue),n._currentValue=t}function li(e){var t=Jl.current;cl(Jl),e.type._context._currentValue=t}function ii(e,t){for(;null!==e;){var n=e.alternate;if(e.childExpirationTime<t)e.childExpirationTime=t,null!==n&&n.childExpirationTime<t&&(n.childExpirationTime=t);else{if(!(null!==n&&n.childExpirationTime<t))break;n.childExpirationTime=t}e=e.return}}function ai(e,t){Zl=e,ti=ei=null,null!==(e=e.dependencies)&&null!==e.firstContext&&(e.expirationTime>=t&&(Aa=!0),e.firstContext=null)}function oi(e,t){if(ti!==e&&!1!==t&&0!==t)if(\"number\"===typeof t&&1073741823!==t||(ti=e,t=1073741823),t={context:e,observedBits:t,next:null},null===ei){if(null===Zl)throw Error(a(308));ei=t,Zl.dependencies={expirationTime:0,firstContext:t,responders:null}}else ei=ei.next=t;return e._currentValue}var ui=!1;function ci(e){return{baseState:e,firstUpdate:null,lastUpdate:null,firstCapturedUpdate:null,lastCapturedUpdate:null,firstEffect:null,lastEffect:null,firstCapturedEffect:null,lastCapturedEffect:null}}function si(e){return{baseState:e.baseState,firstUpdate:e.firstUpdate,lastUpdate:e.lastUpdate,firstCapturedUpdate:null,lastCapturedUpdate:null,firstEffect:null,lastEffect:null,firstCapturedEffect:null,lastCapturedEffect:null}}function fi(e,t){return{expirationTime:e,suspenseConfig:t,tag:0,payload:null,callback:null,next:null,nextEffect:null}}function di(e,t){null===e.lastUpdate?e.firstUpdate=e.lastUpdate=t:(e.lastUpdate.next=t,e.lastUpdate=t)}function pi(e,t){var n=e.alternate;if(null===n){var r=e.updateQueue,l=null;null===r&&(r=e.updateQueue=ci(e.memoizedState))}else r=e.updateQueue,l=n.updateQueue,null===r?null===l?(r=e.updateQueue=ci(e.memoizedState),l=n.updateQueue=ci(n.memoizedState)):r=e.updateQueue=si(l):null===l&&(l=n.updateQueue=si(r));null===l||r===l?di(r,t):null===r.lastUpdate||null===l.lastUpdate?(di(r,t),di(l,t)):(di(r,t),l.lastUpdate=t)}function mi(e,t){var n=e.updateQueue;null===(n=null===n?e.updateQueue=ci(e.memoizedState):hi(e,n)).lastCapturedUpdate?n.firstCapturedUpdate=n.lastCapturedUpdate=t:(n.lastCapturedUpdate.next=t,n.lastCapturedUpdate=t)}function hi(e,t){var n=e.alternate;return null!==n&&t===n.updateQueue&&(t=e.updateQueue=si(t)),t}function yi(e,t,n,r,i,a){switch(n.tag){case 1:return\"function\"===typeof(e=n.payload)?e.call(a,r,i):e;case 3:e.effectTag=-4097&e.effectTag|64;case 0:if(null===(i=\"function\"===typeof(e=n.payload)?e.call(a,r,i):e)||void 0===i)break;return l({},r,i);case 2:ui=!0}return r}function vi(e,t,n,r,l){ui=!1;for(var i=(t=hi(e,t)).baseState,a=null,o=0,u=t.firstUpdate,c=i;null!==u;){var s=u.expirationTime;s<l?(null===a&&(a=u,i=c),o<s&&(o=s)):(fu(s,u.suspenseConfig),c=yi(e,0,u,c,n,r),null!==u.callback&&(e.effectTag|=32,u.nextEffect=null,null===t.lastEffect?t.firstEffect=t.lastEffect=u:(t.lastEffect.nextEffect=u,t.lastEffect=u))),u=u.next}for(s=null,u=t.firstCapturedUpdate;null!==u;){var f=u.expirationTime;f<l?(null===s&&(s=u,null===a&&(i=c)),o<f&&(o=f)):(c=yi(e,0,u,c,n,r),null!==u.callback&&(e.effectTag|=32,u.nextEffect=null,null===t.lastCapturedEffect?t.firstCapturedEffect=t.lastCapturedEffect=u:(t.lastCapturedEffect.nextEffect=u,t.lastCapturedEffect=u))),u=u.next}null===a&&(t.lastUpdate=null),null===s?t.lastCapturedUpdate=null:e.effectTag|=32,null===a&&null===s&&(i=c),t.baseState=i,t.firstUpdate=a,t.firstCapturedUpdate=s,du(o),e.expirationTime=o,e.memoizedState=c}function gi(e,t,n){null!==t.firstCapturedUpdate&&(null!==t.lastUpdate&&(t.lastUpdate.next=t.firstCapturedUpdate,t.lastUpdate=t.lastCapturedUpdate),t.firstCapturedUpdate=t.lastCapturedUpdate=null),bi(t.firstEffect,n),t.firstEffect=t.lastEffect=null,bi(t.firstCapturedEffect,n),t.firstCapturedEffect=t.lastCapturedEffect=null}function bi(e,t){for(;null!==e;){var n=e.callback;if(null!==n){e.callback=null;var r=t;if(\"function\"!==typeof n)throw Error(a(191,n));n.call(r)}e=e.nextEffect}}var wi=R.ReactCurrentBatchConfig,ki=(new r.Component).refs;function Ei(e,t,n,r){n=null===(n=n(r,t=e.memoizedState))||void 0===n?t:l({},t,n),e.memoizedState=n,null!==(r=e.updateQueue)&&0===e.expirationTime&&(r.baseState=n)}var xi={isMounted:function(e){return!!(e=e._reactInternalFiber)&&tt(e)===e},enqueueSetState:function(e,t,n){e=e._reactInternalFiber;var r=Jo(),l=wi.suspense;(l=fi(r=Zo(r,e,l),l)).payload=t,void 0!==n&&null!==n&&(l.callback=n),pi(e,l),eu(e,r)},enqueueReplaceState:function(e,t,n){e=e._reactInternalFiber;var r=Jo(),l=wi.suspense;(l=fi(r=Zo(r,e,l),l)).tag=1,l.payload=t,void 0!==n&&null!==n&&(l.callback=n),pi(e,l),eu(e,r)},enqueueForceUpdate:function(e,t){e=e._reactInternalFiber;var n=Jo(),r=wi.suspense;(r=fi(n=Zo(n,e,r),r)).tag=2,void 0!==t&&null!==t&&(r.callback=t),pi(e,r),eu(e,n)}};function Ti(e,t,n,r,l,i,a){return\"function\"===typeof(e=e.stateNode).shouldComponentUpdate?e.shouldComponentUpdate(r,i,a):!t.prototype||!t.prototype.isPureReactComponent||(!Jr(n,r)||!Jr(l,i))}function Si(e,t,n){var r=!1,l=fl,i=t.contextType;return\"object\"===typeof i&&null!==i?i=oi(i):(l=yl(t)?ml:dl.current,i=(r=null!==(r=t.contextTypes)&&void 0!==r)?hl(e,l):fl),t=new t(n,i),e.memoizedState=null!==t.state&&void 0!==t.state?t.state:null,t.updater=xi,e.stateNode=t,t._reactInternalFiber=e,r&&((e=e.stateNode).__reactInternalMemoizedUnmaskedChildContext=l,e.__reactInternalMemoizedMaskedChildContext=i),t}function Ci(e,t,n,r){e=t.state,\"function\"===typeof t.componentWillReceiveProps&&t.componentWillReceiveProps(n,r),\"function\"===typeof t.UNSAFE_componentWillReceiveProps&&t.UNSAFE_componentWillReceiveProps(n,r),t.state!==e&&xi.enqueueReplaceState(t,t.state,null)}function _i(e,t,n,r){var l=e.stateNode;l.props=n,l.state=e.memoizedState,l.refs=ki;var i=t.contextType;\"object\"===typeof i&&null!==i?l.context=oi(i):(i=yl(t)?ml:dl.current,l.context=hl(e,i)),null!==(i=e.updateQueue)&&(vi(e,i,n,l,r),l.state=e.memoizedState),\"function\"===typeof(i=t.getDerivedStateFromProps)&&(Ei(e,t,i,n),l.state=e.memoizedState),\"function\"===typeof t.getDerivedStateFromProps||\"function\"===typeof l.getSnapshotBeforeUpdate||\"function\"!==typeof l.UNSAFE_componentWillMount&&\"function\"!==typeof l.componentWillMount||(t=l.state,\"function\"===typeof l.componentWillMount&&l.componentWillMount(),\"function\"===typeof l.UNSAFE_componentWillMount&&l.UNSAFE_componentWillMount(),t!==l.state&&xi.enqueueReplaceState(l,l.state,null),null!==(i=e.updateQueue)&&(vi(e,i,n,l,r),l.state=e.memoizedState)),\"function\"===typeof l.componentDidMount&&(e.effectTag|=4)}var Pi=Array.isArray;function Ni(e,t,n){if(null!==(e=n.ref)&&\"function\"!==typeof e&&\"object\"!==typeof e){if(n._owner){if(n=n._owner){if(1!==n.tag)throw Error(a(309));var r=n.stateNode}if(!r)throw Error(a(147,e));var l=\"\"+e;return null!==t&&null!==t.ref&&\"function\"===typeof t.ref&&t.ref._stringRef===l?t.ref:((t=function(e){var t=r.refs;t===ki&&(t=r.refs={}),null===e?delete t[l]:t[l]=e})._stringRef=l,t)}if(\"string\"!==typeof e)throw Error(a(284));if(!n._owner)throw Error(a(290,e))}return e}function Oi(e,t){if(\"textarea\"!==e.type)throw Error(a(31,\"[object Object]\"===Object.prototype.toString.call(t)?\"object with keys {\"+Object.keys(t).join(\", \")+\"}\":t,\"\"))}function zi(e){function t(t,n){if(e){var r=t.lastEffect;null!==r?(r.nextEffect=n,t.lastEffect=n):t.firstEffect=t.lastEffect=n,n.nextEffect=null,n.effectTag=8}}function n(n,r){if(!e)return null;for(;null!==r;)t(n,r),r=r.sibling;return null}function r(e,t){for(e=new Map;null!==t;)null!==t.key?e.set(t.key,t):e.set(t.index,t),t=t.sibling;return e}function l(e,t,n){return(e=Mu(e,t)).index=0,e.sibling=null,e}function i(t,n,r){return t.index=r,e?null!==(r=t.alternate)?(r=r.index)<n?(t.effectTag=2,n):r:(t.effectTag=2,n):n}function o(t){return e&&null===t.alternate&&(t.effectTag=2),t}function u(e,t,n,r){return null===t||6!==t.tag?((t=Fu(n,e.mode,r)).return=e,t):((t=l(t,n)).return=e,t)}function c(e,t,n,r){return null!==t&&t.elementType===n.type?((r=l(t,n.props)).ref=Ni(e,t,n),r.return=e,r):((r=Ru(n.type,n.key,n.props,null,e.mode,r)).ref=Ni(e,t,n),r.return=e,r)}function s(e,t,n,r){return null===t||4!==t.tag||t.stateNode.containerInfo!==n.containerInfo||t.stateNode.implementation!==n.implementation?((t=Uu(n,e.mode,r)).return=e,t):((t=l(t,n.children||[])).return=e,t)}function f(e,t,n,r,i){return null===t||7!==t.tag?((t=Iu(n,e.mode,r,i)).return=e,t):((t=l(t,n)).return=e,t)}function d(e,t,n){if(\"string\"===typeof t||\"number\"===typeof t)return(t=Fu(\"\"+t,e.mode,n)).return=e,t;if(\"object\"===typeof t&&null!==t){switch(t.$$typeof){case U:return(n=Ru(t.type,t.key,t.props,null,e.mode,n)).ref=Ni(e,null,t),n.return=e,n;case D:return(t=Uu(t,e.mode,n)).return=e,t}if(Pi(t)||X(t))return(t=Iu(t,e.mode,n,null)).return=e,t;Oi(e,t)}return null}function p(e,t,n,r){var l=null!==t?t.key:null;if(\"string\"===typeof n||\"number\"===typeof n)return null!==l?null:u(e,t,\"\"+n,r);if(\"object\"===typeof n&&null!==n){switch(n.$$typeof){case U:return n.key===l?n.type===L?f(e,t,n.props.children,r,l):c(e,t,n,r):null;case D:return n.key===l?s(e,t,n,r):null}if(Pi(n)||X(n))return null!==l?null:f(e,t,n,r,null);Oi(e,n)}return null}function m(e,t,n,r,l){if(\"string\"===typeof r||\"number\"===typeof r)return u(t,e=e.get(n)||null,\"\"+r,l);if(\"object\"===typeof r&&null!==r){switch(r.$$typeof){case U:return e=e.get(null===r.key?n:r.key)||null,r.type===L?f(t,e,r.props.children,l,r.key):c(t,e,r,l);case D:return s(t,e=e.get(null===r.key?n:r.key)||null,r,l)}if(Pi(r)||X(r))return f(t,e=e.get(n)||null,r,l,null);Oi(t,r)}return null}function h(l,a,o,u){for(var c=null,s=null,f=a,h=a=0,y=null;null!==f&&h<o.length;h++){f.index>h?(y=f,f=null):y=f.sibling;var v=p(l,f,o[h],u);if(null===v){null===f&&(f=y);break}e&&f&&null===v.alternate&&t(l,f),a=i(v,a,h),null===s?c=v:s.sibling=v,s=v,f=y}if(h===o.length)return n(l,f),c;if(null===f){for(;h<o.length;h++)null!==(f=d(l,o[h],u))&&(a=i(f,a,h),null===s?c=f:s.sibling=f,s=f);return c}for(f=r(l,f);h<o.length;h++)null!==(y=m(f,l,h,o[h],u))&&(e&&null!==y.alternate&&f.delete(null===y.key?h:y.key),a=i(y,a,h),null===s?c=y:s.sibling=y,s=y);return e&&f.forEach((function(e){return t(l,e)})),c}function y(l,o,u,c){var s=X(u);if(\"function\"!==typeof s)throw Error(a(150));if(null==(u=s.call(u)))throw Error(a(151));for(var f=s=null,h=o,y=o=0,v=null,g=u.next();null!==h&&!g.done;y++,g=u.next()){h.index>y?(v=h,h=null):v=h.sibling;var b=p(l,h,g.value,c);if(null===b){null===h&&(h=v);break}e&&h&&null===b.alternate&&t(l,h),o=i(b,o,y),null===f?s=b:f.sibling=b,f=b,h=v}if(g.done)return n(l,h),s;if(null===h){for(;!g.done;y++,g=u.next())null!==(g=d(l,g.value,c))&&(o=i(g,o,y),null===f?s=g:f.sibling=g,f=g);return s}for(h=r(l,h);!g.done;y++,g=u.next())null!==(g=m(h,l,y,g.value,c))&&(e&&null!==g.alternate&&h.delete(null===g.key?y:g.key),o=i(g,o,y),null===f?s=g:f.sibling=g,f=g);return e&&h.forEach((function(e){return t(l,e)})),s}return function(e,r,i,u){var c=\"object\"===typeof i&&null!==i&&i.type===L&&null===i.key;c&&(i=i.props.children);var s=\"object\"===typeof i&&null!==i;if(s)switch(i.$$typeof){case U:e:{for(s=i.key,c=r;null!==c;){if(c.key===s){if(7===c.tag?i.type===L:c.elementType===i.type){n(e,c.sibling),(r=l(c,i.type===L?i.props.children:i.props)).ref=Ni(e,c,i),r.return=e,e=r;break e}n(e,c);break}t(e,c),c=c.sibling}i.type===L?((r=Iu(i.props.children,e.mode,u,i.key)).return=e,e=r):((u=Ru(i.type,i.key,i.props,null,e.mode,u)).ref=Ni(e,r,i),u.return=e,e=u)}return o(e);case D:e:{for(c=i.key;null!==r;){if(r.key===c){if(4===r.tag&&r.stateNode.containerInfo===i.containerInfo&&r.stateNode.implementation===i.implementation){n(e,r.sibling),(r=l(r,i.children||[])).return=e,e=r;break e}n(e,r);break}t(e,r),r=r.sibling}(r=Uu(i,e.mode,u)).return=e,e=r}return o(e)}if(\"string\"===typeof i||\"number\"===typeof i)return i=\"\"+i,null!==r&&6===r.tag?(n(e,r.sibling),(r=l(r,i)).return=e,e=r):(n(e,r),(r=Fu(i,e.mode,u)).return=e,e=r),o(e);if(Pi(i))return h(e,r,i,u);if(X(i))return y(e,r,i,u);if(s&&Oi(e,i),\"undefined\"===typeof i&&!c)switch(e.tag){case 1:case 0:throw e=e.type,Error(a(152,e.displayName||e.name||\"Component\"))}return n(e,r)}}var Mi=zi(!0),Ri=zi(!1),Ii={},Fi={current:Ii},Ui={current:Ii},Di={current:Ii};function Li(e){if(e===Ii)throw Error(a(174));return e}function ji(e,t){sl(Di,t),sl(Ui,e),sl(Fi,Ii);var n=t.nodeType;switch(n){case 9:case 11:t=(t=t.documentElement)?t.namespaceURI:Ve(null,\"\");break;default:t=Ve(t=(n=8===n?t.parentNode:t).namespaceURI||null,n=n.tagName)}cl(Fi),sl(Fi,t)}function Ai(e){cl(Fi),cl(Ui),cl(Di)}function Vi(e){Li(Di.current);var t=Li(Fi.current),n=Ve(t,e.type);t!==n&&(sl(Ui,e),sl(Fi,n))}function Wi(e){Ui.current===e&&(cl(Fi),cl(Ui))}var $i={current:0};function Bi(e){for(var t=e;null!==t;){if(13===t.tag){var n=t.memoizedState;if(null!==n&&(null===(n=n.dehydrated)||\"$?\"===n.data||\"$!\"===n.data))return t}else if(19===t.tag&&void 0!==t.memoizedProps.revealOrder){if(0!==(64&t.effectTag))return t}else if(null!==t.child){t.child.return=t,t=t.child;continue}if(t===e)break;for(;null===t.sibling;){if(null===t.return||t.return===e)return null;t=t.return}t.sibling.return=t.return,t=t.sibling}return null}function Hi(e,t){return{responder:e,props:t}}var Qi=R.ReactCurrentDispatcher,Ki=R.ReactCurrentBatchConfig,qi=0,Yi=null,Xi=null,Gi=null,Ji=null,Zi=null,ea=null,ta=0,na=null,ra=0,la=!1,ia=null,aa=0;function oa(){throw Error(a(321))}function ua(e,t){if(null===t)return!1;for(var n=0;n<t.length&&n<e.length;n++)if(!Xr(e[n],t[n]))return!1;return!0}function ca(e,t,n,r,l,i){if(qi=i,Yi=t,Gi=null!==e?e.memoizedState:null,Qi.current=null===Gi?Pa:Na,t=n(r,l),la){do{la=!1,aa+=1,Gi=null!==e?e.memoizedState:null,ea=Ji,na=Zi=Xi=null,Qi.current=Na,t=n(r,l)}while(la);ia=null,aa=0}if(Qi.current=_a,(e=Yi).memoizedState=Ji,e.expirationTime=ta,e.updateQueue=na,e.effectTag|=ra,e=null!==Xi&&null!==Xi.next,qi=0,ea=Zi=Ji=Gi=Xi=Yi=null,ta=0,na=null,ra=0,e)throw Error(a(300));return t}function sa(){Qi.current=_a,qi=0,ea=Zi=Ji=Gi=Xi=Yi=null,ta=0,na=null,ra=0,la=!1,ia=null,aa=0}function fa(){var e={memoizedState:null,baseState:null,queue:null,baseUpdate:null,next:null};return null===Zi?Ji=Zi=e:Zi=Zi.next=e,Zi}function da(){if(null!==ea)ea=(Zi=ea).next,Gi=null!==(Xi=Gi)?Xi.next:null;else{if(null===Gi)throw Error(a(310));var e={memoizedState:(Xi=Gi).memoizedState,baseState:Xi.baseState,queue:Xi.queue,baseUpdate:Xi.baseUpdate,next:null};Zi=null===Zi?Ji=e:Zi.next=e,Gi=Xi.next}return Zi}function pa(e,t){return\"function\"===typeof t?t(e):t}function ma(e){var t=da(),n=t.queue;if(null===n)throw Error(a(311));if(n.lastRenderedReducer=e,0<aa){var r=n.dispatch;if(null!==ia){var l=ia.get(n);if(void 0!==l){ia.delete(n);var i=t.memoizedState;do{i=e(i,l.action),l=l.next}while(null!==l);return Xr(i,t.memoizedState)||(Aa=!0),t.memoizedState=i,t.baseUpdate===n.last&&(t.baseState=i),n.lastRenderedState=i,[i,r]}}return[t.memoizedState,r]}r=n.last;var o=t.baseUpdate;if(i=t.baseState,null!==o?(null!==r&&(r.next=null),r=o.next):r=null!==r?r.next:null,null!==r){var u=l=null,c=r,s=!1;do{var f=c.expirationTime;f<qi?(s||(s=!0,u=o,l=i),f>ta&&du(ta=f)):(fu(f,c.suspenseConfig),i=c.eagerReducer===e?c.eagerState:e(i,c.action)),o=c,c=c.next}while(null!==c&&c!==r);s||(u=o,l=i),Xr(i,t.memoizedState)||(Aa=!0),t.memoizedState=i,t.baseUpdate=u,t.baseState=l,n.lastRenderedState=i}return[t.memoizedState,n.dispatch]}function ha(e){var t=fa();return\"function\"===typeof e&&(e=e()),t.memoizedState=t.baseState=e,e=(e=t.queue={last:null,dispatch:null,lastRenderedReducer:pa,lastRenderedState:e}).dispatch=Ca.bind(null,Yi,e),[t.memoizedState,e]}function ya(e){return ma(pa)}function va(e,t,n,r){return e={tag:e,create:t,destroy:n,deps:r,next:null},null===na?(na={lastEffect:null}).lastEffect=e.next=e:null===(t=na.lastEffect)?na.lastEffect=e.next=e:(n=t.next,t.next=e,e.next=n,na.lastEffect=e),e}function ga(e,t,n,r){var l=fa();ra|=e,l.memoizedState=va(t,n,void 0,void 0===r?null:r)}function ba(e,t,n,r){var l=da();r=void 0===r?null:r;var i=void 0;if(null!==Xi){var a=Xi.memoizedState;if(i=a.destroy,null!==r&&ua(r,a.deps))return void va(0,n,i,r)}ra|=e,l.memoizedState=va(t,n,i,r)}function wa(e,t){return ga(516,192,e,t)}function ka(e,t){return ba(516,192,e,t)}function Ea(e,t){return\"function\"===typeof t?(e=e(),t(e),function(){t(null)}):null!==t&&void 0!==t?(e=e(),t.current=e,function(){t.current=null}):void 0}function xa(){}function Ta(e,t){return fa().memoizedState=[e,void 0===t?null:t],e}function Sa(e,t){var n=da();t=void 0===t?null:t;var r=n.memoizedState;return null!==r&&null!==t&&ua(t,r[1])?r[0]:(n.memoizedState=[e,t],e)}function Ca(e,t,n){if(!(25>aa))throw Error(a(301));var r=e.alternate;if(e===Yi||null!==r&&r===Yi)if(la=!0,e={expirationTime:qi,suspenseConfig:null,action:n,eagerReducer:null,eagerState:null,next:null},null===ia&&(ia=new Map),void 0===(n=ia.get(t)))ia.set(t,e);else{for(t=n;null!==t.next;)t=t.next;t.next=e}else{var l=Jo(),i=wi.suspense;i={expirationTime:l=Zo(l,e,i),suspenseConfig:i,action:n,eagerReducer:null,eagerState:null,next:null};var o=t.last;if(null===o)i.next=i;else{var u=o.next;null!==u&&(i.next=u),o.next=i}if(t.last=i,0===e.expirationTime&&(null===r||0===r.expirationTime)&&null!==(r=t.lastRenderedReducer))try{var c=t.lastRenderedState,s=r(c,n);if(i.eagerReducer=r,i.eagerState=s,Xr(s,c))return}catch(f){}eu(e,l)}}var _a={readContext:oi,useCallback:oa,useContext:oa,useEffect:oa,useImperativeHandle:oa,useLayoutEffect:oa,useMemo:oa,useReducer:oa,useRef:oa,useState:oa,useDebugValue:oa,useResponder:oa,useDeferredValue:oa,useTransition:oa},Pa={readContext:oi,useCallback:Ta,useContext:oi,useEffect:wa,useImperativeHandle:function(e,t,n){return n=null!==n&&void 0!==n?n.concat([e]):null,ga(4,36,Ea.bind(null,t,e),n)},useLayoutEffect:function(e,t){return ga(4,36,e,t)},useMemo:function(e,t){var n=fa();return t=void 0===t?null:t,e=e(),n.memoizedState=[e,t],e},useReducer:function(e,t,n){var r=fa();return t=void 0!==n?n(t):t,r.memoizedState=r.baseState=t,e=(e=r.queue={last:null,dispatch:null,lastRenderedReducer:e,lastRenderedState:t}).dispatch=Ca.bind(null,Yi,e),[r.memoizedState,e]},useRef:function(e){return e={current:e},fa().memoizedState=e},useState:ha,useDebugValue:xa,useResponder:Hi,useDeferredValue:function(e,t){var n=ha(e),r=n[0],l=n[1];return wa((function(){i.unstable_next((function(){var n=Ki.suspense;Ki.suspense=void 0===t?null:t;try{l(e)}finally{Ki.suspense=n}}))}),[e,t]),r},useTransition:function(e){var t=ha(!1),n=t[0],r=t[1];return[Ta((function(t){r(!0),i.unstable_next((function(){var n=Ki.suspense;Ki.suspense=void 0===e?null:e;try{r(!1),t()}finally{Ki.suspense=n}}))}),[e,n]),n]}},Na={readContext:oi,useCallback:Sa,useContext:oi,useEffect:ka,useImperativeHandle:function(e,t,n){return n=null!==n&&void 0!==n?n.concat([e]):null,ba(4,36,Ea.bind(null,t,e),n)},useLayoutEffect:function(e,t){return ba(4,36,e,t)},useMemo:function(e,t){var n=da();t=void 0===t?null:t;var r=n.memoizedState;return null!==r&&null!==t&&ua(t,r[1])?r[0]:(e=e(),n.memoizedState=[e,t],e)},useReducer:ma,useRef:function(){return da().memoizedState},useState:ya,useDebugValue:xa,useResponder:Hi,useDeferredValue:function(e,t){var n=ya(),r=n[0],l=n[1];return ka((function(){i.unstable_next((function(){var n=Ki.suspense;Ki.suspense=void 0===t?null:t;try{l(e)}finally{Ki.suspense=n}}))}),[e,t]),r},useTransition:function(e){var t=ya(),n=t[0],r=t[1];return[Sa((function(t){r(!0),i.unstable_next((function(){var n=Ki.suspense;Ki.suspense=void 0===e?null:e;try{r(!1),t()}finally{Ki.suspense=n}}))}),[e,n]),n]}},Oa=null,za=null,Ma=!1;function Ra(e,t){var n=Ou(5,null,null,0);n.elementType=\"DELETED\",n.type=\"DELETED\",n.stateNode=t,n.return=e,n.effectTag=8,null!==e.lastEffect?(e.lastEffect.nextEffect=n,e.lastEffect=n):e.firstEffect=e.lastEffect=n}function Ia(e,t){switch(e.tag){case 5:var n=e.type;return null!==(t=1!==t.nodeType||n.toLowerCase()!==t.nodeName.toLowerCase()?null:t)&&(e.stateNode=t,!0);case 6:return null!==(t=\"\"===e.pendingProps||3!==t.nodeType?null:t)&&(e.stateNode=t,!0);case 13:default:return!1}}function Fa(e){if(Ma){var t=za;if(t){var n=t;if(!Ia(e,t)){if(!(t=nr(n.nextSibling))||!Ia(e,t))return e.effectTag=-1025&e.effectTag|2,Ma=!1,void(Oa=e);Ra(Oa,n)}Oa=e,za=nr(t.firstChild)}else e.effectTag=-1025&e.effectTag|2,Ma=!1,Oa=e}}function Ua(e){for(e=e.return;null!==e&&5!==e.tag&&3!==e.tag&&13!==e.tag;)e=e.return;Oa=e}function Da(e){if(e!==Oa)return!1;if(!Ma)return Ua(e),Ma=!0,!1;var t=e.type;if(5!==e.tag||\"head\"!==t&&\"body\"!==t&&!Zn(t,e.memoizedProps))for(t=za;t;)Ra(e,t),t=nr(t.nextSibling);if(Ua(e),13===e.tag){if(!(e=null!==(e=e.memoizedState)?e.dehydrated:null))throw Error(a(317));e:{for(e=e.nextSibling,t=0;e;){if(8===e.nodeType){var n=e.data;if(\"/$\"===n){if(0===t){za=nr(e.nextSibling);break e}t--}else\"$\"!==n&&\"$!\"!==n&&\"$?\"!==n||t++}e=e.nextSibling}za=null}}else za=Oa?nr(e.stateNode.nextSibling):null;return!0}function La(){za=Oa=null,Ma=!1}var ja=R.ReactCurrentOwner,Aa=!1;function Va(e,t,n,r){t.child=null===e?Ri(t,null,n,r):Mi(t,e.child,n,r)}function Wa(e,t,n,r,l){n=n.render;var i=t.ref;return ai(t,l),r=ca(e,t,n,r,i,l),null===e||Aa?(t.effectTag|=1,Va(e,t,r,l),t.child):(t.updateQueue=e.updateQueue,t.effectTag&=-517,e.expirationTime<=l&&(e.expirationTime=0),lo(e,t,l))}function $a(e,t,n,r,l,i){if(null===e){var a=n.type;return\"function\"!==typeof a||zu(a)||void 0!==a.defaultProps||null!==n.compare||void 0!==n.defaultProps?((e=Ru(n.type,null,r,null,t.mode,i)).ref=t.ref,e.return=t,t.child=e):(t.tag=15,t.type=a,Ba(e,t,a,r,l,i))}return a=e.child,l<i&&(l=a.memoizedProps,(n=null!==(n=n.compare)?n:Jr)(l,r)&&e.ref===t.ref)?lo(e,t,i):(t.effectTag|=1,(e=Mu(a,r)).ref=t.ref,e.return=t,t.child=e)}function Ba(e,t,n,r,l,i){return null!==e&&Jr(e.memoizedProps,r)&&e.ref===t.ref&&(Aa=!1,l<i)?lo(e,t,i):Qa(e,t,n,r,i)}function Ha(e,t){var n=t.ref;(null===e&&null!==n||null!==e&&e.ref!==n)&&(t.effectTag|=128)}function Qa(e,t,n,r,l){var i=yl(n)?ml:dl.current;return i=hl(t,i),ai(t,l),n=ca(e,t,n,r,i,l),null===e||Aa?(t.effectTag|=1,Va(e,t,n,l),t.child):(t.updateQueue=e.updateQueue,t.effectTag&=-517,e.expirationTime<=l&&(e.expirationTime=0),lo(e,t,l))}function Ka(e,t,n,r,l){if(yl(n)){var i=!0;kl(t)}else i=!1;if(ai(t,l),null===t.stateNode)null!==e&&(e.alternate=null,t.alternate=null,t.effectTag|=2),Si(t,n,r),_i(t,n,r,l),r=!0;else if(null===e){var a=t.stateNode,o=t.memoizedProps;a.props=o;var u=a.context,c=n.contextType;\"object\"===typeof c&&null!==c?c=oi(c):c=hl(t,c=yl(n)?ml:dl.current);var s=n.getDerivedStateFromProps,f=\"function\"===typeof s||\"function\"===typeof a.getSnapshotBeforeUpdate;f||\"function\"!==typeof a.UNSAFE_componentWillReceiveProps&&\"function\"!==typeof a.componentWillReceiveProps||(o!==r||u!==c)&&Ci(t,a,r,c),ui=!1;var d=t.memoizedState;u=a.state=d;var p=t.updateQueue;null!==p&&(vi(t,p,r,a,l),u=t.memoizedState),o!==r||d!==u||pl.current||ui?(\"function\"===typeof s&&(Ei(t,n,s,r),u=t.memoizedState),(o=ui||Ti(t,n,o,r,d,u,c))?(f||\"function\"!==typeof a.UNSAFE_componentWillMount&&\"function\"!==typeof a.componentWillMount||(\"function\"===typeof a.componentWillMount&&a.componentWillMount(),\"function\"===typeof a.UNSAFE_componentWillMount&&a.UNSAFE_componentWillMount()),\"function\"===typeof a.componentDidMount&&(t.effectTag|=4)):(\"function\"===typeof a.componentDidMount&&(t.effectTag|=4),t.memoizedProps=r,t.memoizedState=u),a.props=r,a.state=u,a.context=c,r=o):(\"function\"===typeof a.componentDidMount&&(t.effectTag|=4),r=!1)}else a=t.stateNode,o=t.memoizedProps,a.props=t.type===t.elementType?o:Gl(t.type,o),u=a.context,\"object\"===typeof(c=n.contextType)&&null!==c?c=oi(c):c=hl(t,c=yl(n)?ml:dl.current),(f=\"function\"===typeof(s=n.getDerivedStateFromProps)||\"function\"===typeof a.getSnapshotBeforeUpdate)||\"function\"!==typeof a.UNSAFE_componentWillReceiveProps&&\"function\"!==typeof a.componentWillReceiveProps||(o!==r||u!==c)&&Ci(t,a,r,c),ui=!1,u=t.memoizedState,d=a.state=u,null!==(p=t.updateQueue)&&(vi(t,p,r,a,l),d=t.memoizedState),o!==r||u!==d||pl.current||ui?(\"function\"===typeof s&&(Ei(t,n,s,r),d=t.memoizedState),(s=ui||Ti(t,n,o,r,u,d,c))?(f||\"function\"!==typeof a.UNSAFE_componentWillUpdate&&\"function\"!==typeof a.componentWillUpdate||(\"function\"===typeof a.componentWillUpdate&&a.componentWillUpdate(r,d,c),\"function\"===typeof a.UNSAFE_componentWillUpdate&&a.UNSAFE_componentWillUpdate(r,d,c)),\"function\"===typeof a.componentDidUpdate&&(t.effectTag|=4),\"function\"===typeof a.getSnapshotBeforeUpdate&&(t.effectTag|=256)):(\"function\"!==typeof a.componentDidUpdate||o===e.memoizedProps&&u===e.memoizedState||(t.effectTag|=4),\"function\"!==typeof a.getSnapshotBeforeUpdate||o===e.memoizedProps&&u===e.memoizedState||(t.effectTag|=256),t.memoizedProps=r,t.memoizedState=d),a.props=r,a.state=d,a.context=c,r=s):(\"function\"!==typeof a.componentDidUpdate||o===e.memoizedProps&&u===e.memoizedState||(t.effectTag|=4),\"function\"!==typeof a.getSnapshotBeforeUpdate||o===e.memoizedProps&&u===e.memoizedState||(t.effectTag|=256),r=!1);return qa(e,t,n,r,i,l)}function qa(e,t,n,r,l,i){Ha(e,t);var a=0!==(64&t.effectTag);if(!r&&!a)return l&&El(t,n,!1),lo(e,t,i);r=t.stateNode,ja.current=t;var o=a&&\"function\"!==typeof n.getDerivedStateFromError?null:r.render();return t.effectTag|=1,null!==e&&a?(t.child=Mi(t,e.child,null,i),t.child=Mi(t,null,o,i)):Va(e,t,o,i),t.memoizedState=r.state,l&&El(t,n,!0),t.child}function Ya(e){var t=e.stateNode;t.pendingContext?bl(0,t.pendingContext,t.pendingContext!==t.context):t.context&&bl(0,t.context,!1),ji(e,t.containerInfo)}var Xa,Ga,Ja,Za={dehydrated:null,retryTime:0};function eo(e,t,n){var r,l=t.mode,i=t.pendingProps,a=$i.current,o=!1;if((r=0!==(64&t.effectTag))||(r=0!==(2&a)&&(null===e||null!==e.memoizedState)),r?(o=!0,t.effectTag&=-65):null!==e&&null===e.memoizedState||void 0===i.fallback||!0===i.unstable_avoidThisFallback||(a|=1),sl($i,1&a),null===e){if(void 0!==i.fallback&&Fa(t),o){if(o=i.fallback,(i=Iu(null,l,0,null)).return=t,0===(2&t.mode))for(e=null!==t.memoizedState?t.child.child:t.child,i.child=e;null!==e;)e.return=i,e=e.sibling;return(n=Iu(o,l,n,null)).return=t,i.sibling=n,t.memoizedState=Za,t.child=i,n}return l=i.children,t.memoizedState=null,t.child=Ri(t,null,l,n)}if(null!==e.memoizedState){if(l=(e=e.child).sibling,o){if(i=i.fallback,(n=Mu(e,e.pendingProps)).return=t,0===(2&t.mode)&&(o=null!==t.memoizedState?t.child.child:t.child)!==e.child)for(n.child=o;null!==o;)o.return=n,o=o.sibling;return(l=Mu(l,i,l.expirationTime)).return=t,n.sibling=l,n.childExpirationTime=0,t.memoizedState=Za,t.child=n,l}return n=Mi(t,e.child,i.children,n),t.memoizedState=null,t.child=n}if(e=e.child,o){if(o=i.fallback,(i=Iu(null,l,0,null)).return=t,i.child=e,null!==e&&(e.return=i),0===(2&t.mode))for(e=null!==t.memoizedState?t.child.child:t.child,i.child=e;null!==e;)e.return=i,e=e.sibling;return(n=Iu(o,l,n,null)).return=t,i.sibling=n,n.effectTag|=2,i.childExpirationTime=0,t.memoizedState=Za,t.child=i,n}return t.memoizedState=null,t.child=Mi(t,e,i.children,n)}function to(e,t){e.expirationTime<t&&(e.expirationTime=t);var n=e.alternate;null!==n&&n.expirationTime<t&&(n.expirationTime=t),ii(e.return,t)}function no(e,t,n,r,l,i){var a=e.memoizedState;null===a?e.memoizedState={isBackwards:t,rendering:null,last:r,tail:n,tailExpiration:0,tailMode:l,lastEffect:i}:(a.isBackwards=t,a.rendering=null,a.last=r,a.tail=n,a.tailExpiration=0,a.tailMode=l,a.lastEffect=i)}function ro(e,t,n){var r=t.pendingProps,l=r.revealOrder,i=r.tail;if(Va(e,t,r.children,n),0!==(2&(r=$i.current)))r=1&r|2,t.effectTag|=64;else{if(null!==e&&0!==(64&e.effectTag))e:for(e=t.child;null!==e;){if(13===e.tag)null!==e.memoizedState&&to(e,n);else if(19===e.tag)to(e,n);else if(null!==e.child){e.child.return=e,e=e.child;continue}if(e===t)break e;for(;null===e.sibling;){if(null===e.return||e.return===t)break e;e=e.return}e.sibling.return=e.return,e=e.sibling}r&=1}if(sl($i,r),0===(2&t.mode))t.memoizedState=null;else switch(l){case\"forwards\":for(n=t.child,l=null;null!==n;)null!==(e=n.alternate)&&null===Bi(e)&&(l=n),n=n.sibling;null===(n=l)?(l=t.child,t.child=null):(l=n.sibling,n.sibling=null),no(t,!1,l,n,i,t.lastEffect);break;case\"backwards\":for(n=null,l=t.child,t.child=null;null!==l;){if(null!==(e=l.alternate)&&null===Bi(e)){t.child=l;break}e=l.sibling,l.sibling=n,n=l,l=e}no(t,!0,n,null,i,t.lastEffect);break;case\"together\":no(t,!1,null,null,void 0,t.lastEffect);break;default:t.memoizedState=null}return t.child}function lo(e,t,n){null!==e&&(t.dependencies=e.dependencies);var r=t.expirationTime;if(0!==r&&du(r),t.childExpirationTime<n)return null;if(null!==e&&t.child!==e.child)throw Error(a(153));if(null!==t.child){for(n=Mu(e=t.child,e.pendingProps,e.expirationTime),t.child=n,n.return=t;null!==e.sibling;)e=e.sibling,(n=n.sibling=Mu(e,e.pendingProps,e.expirationTime)).return=t;n.sibling=null}return t.child}function io(e){e.effectTag|=4}function ao(e,t){switch(e.tailMode){case\"hidden\":t=e.tail;for(var n=null;null!==t;)null!==t.alternate&&(n=t),t=t.sibling;null===n?e.tail=null:n.sibling=null;break;case\"collapsed\":n=e.tail;for(var r=null;null!==n;)null!==n.alternate&&(r=n),n=n.sibling;null===r?t||null===e.tail?e.tail=null:e.tail.sibling=null:r.sibling=null}}function oo(e){switch(e.tag){case 1:yl(e.type)&&vl();var t=e.effectTag;return 4096&t?(e.effectTag=-4097&t|64,e):null;case 3:if(Ai(),gl(),0!==(64&(t=e.effectTag)))throw Error(a(285));return e.effectTag=-4097&t|64,e;case 5:return Wi(e),null;case 13:return cl($i),4096&(t=e.effectTag)?(e.effectTag=-4097&t|64,e):null;case 19:return cl($i),null;case 4:return Ai(),null;case 10:return li(e),null;default:return null}}function uo(e,t){return{value:e,source:t,stack:J(t)}}Xa=function(e,t){for(var n=t.child;null!==n;){if(5===n.tag||6===n.tag)e.appendChild(n.stateNode);else if(4!==n.tag&&null!==n.child){n.child.return=n,n=n.child;continue}if(n===t)break;for(;null===n.sibling;){if(null===n.return||n.return===t)return;n=n.return}n.sibling.return=n.return,n=n.sibling}},Ga=function(e,t,n,r,i){var a=e.memoizedProps;if(a!==r){var o,u,c=t.stateNode;switch(Li(Fi.current),e=null,n){case\"input\":a=Ce(c,a),r=Ce(c,r),e=[];break;case\"option\":a=Me(c,a),r=Me(c,r),e=[];break;case\"select\":a=l({},a,{value:void 0}),r=l({},r,{value:void 0}),e=[];break;case\"textarea\":a=Ie(c,a),r=Ie(c,r),e=[];break;default:\"function\"!==typeof a.onClick&&\"function\"===typeof r.onClick&&(c.onclick=Bn)}for(o in Vn(n,r),n=null,a)if(!r.hasOwnProperty(o)&&a.hasOwnProperty(o)&&null!=a[o])if(\"style\"===o)for(u in c=a[o])c.hasOwnProperty(u)&&(n||(n={}),n[u]=\"\");else\"dangerouslySetInnerHTML\"!==o&&\"children\"!==o&&\"suppressContentEditableWarning\"!==o&&\"suppressHydrationWarning\"!==o&&\"autoFocus\"!==o&&(p.hasOwnProperty(o)?e||(e=[]):(e=e||[]).push(o,null));for(o in r){var s=r[o];if(c=null!=a?a[o]:void 0,r.hasOwnProperty(o)&&s!==c&&(null!=s||null!=c))if(\"style\"===o)if(c){for(u in c)!c.hasOwnProperty(u)||s&&s.hasOwnProperty(u)||(n||(n={}),n[u]=\"\");for(u in s)s.hasOwnProperty(u)&&c[u]!==s[u]&&(n||(n={}),n[u]=s[u])}else n||(e||(e=[]),e.push(o,n)),n=s;else\"dangerouslySetInnerHTML\"===o?(s=s?s.__html:void 0,c=c?c.__html:void 0,null!=s&&c!==s&&(e=e||[]).push(o,\"\"+s)):\"children\"===o?c===s||\"string\"!==typeof s&&\"number\"!==typeof s||(e=e||[]).push(o,\"\"+s):\"suppressContentEditableWarning\"!==o&&\"suppressHydrationWarning\"!==o&&(p.hasOwnProperty(o)?(null!=s&&$n(i,o),e||c===s||(e=[])):(e=e||[]).push(o,s))}n&&(e=e||[]).push(\"style\",n),i=e,(t.updateQueue=i)&&io(t)}},Ja=function(e,t,n,r){n!==r&&io(t)};var co=\"function\"===typeof WeakSet?WeakSet:Set;function so(e,t){var n=t.source,r=t.stack;null===r&&null!==n&&(r=J(n)),null!==n&&G(n.type),t=t.value,null!==e&&1===e.tag&&G(e.type);try{console.error(t)}catch(l){setTimeout((function(){throw l}))}}function fo(e){var t=e.ref;if(null!==t)if(\"function\"===typeof t)try{t(null)}catch(n){Tu(e,n)}else t.current=null}function po(e,t){switch(t.tag){case 0:case 11:case 15:mo(2,0,t);break;case 1:if(256&t.effectTag&&null!==e){var n=e.memoizedProps,r=e.memoizedState;t=(e=t.stateNode).getSnapshotBeforeUpdate(t.elementType===t.type?n:Gl(t.type,n),r),e.__reactInternalSnapshotBeforeUpdate=t}break;case 3:case 5:case 6:case 4:case 17:break;default:throw Error(a(163))}}function mo(e,t,n){if(null!==(n=null!==(n=n.updateQueue)?n.lastEffect:null)){var r=n=n.next;do{if(0!==(r.tag&e)){var l=r.destroy;r.destroy=void 0,void 0!==l&&l()}0!==(r.tag&t)&&(l=r.create,r.destroy=l()),r=r.next}while(r!==n)}}function ho(e,t,n){switch(\"function\"===typeof Pu&&Pu(t),t.tag){case 0:case 11:case 14:case 15:if(null!==(e=t.updateQueue)&&null!==(e=e.lastEffect)){var r=e.next;Bl(97<n?97:n,(function(){var e=r;do{var n=e.destroy;if(void 0!==n){var l=t;try{n()}catch(i){Tu(l,i)}}e=e.next}while(e!==r)}))}break;case 1:fo(t),\"function\"===typeof(n=t.stateNode).componentWillUnmount&&function(e,t){try{t.props=e.memoizedProps,t.state=e.memoizedState,t.componentWillUnmount()}catch(n){Tu(e,n)}}(t,n);break;case 5:fo(t);break;case 4:bo(e,t,n)}}function yo(e){var t=e.alternate;e.return=null,e.child=null,e.memoizedState=null,e.updateQueue=null,e.dependencies=null,e.alternate=null,e.firstEffect=null,e.lastEffect=null,e.pendingProps=null,e.memoizedProps=null,null!==t&&yo(t)}function vo(e){return 5===e.tag||3===e.tag||4===e.tag}function go(e){e:{for(var t=e.return;null!==t;){if(vo(t)){var n=t;break e}t=t.return}throw Error(a(160))}switch(t=n.stateNode,n.tag){case 5:var r=!1;break;case 3:case 4:t=t.containerInfo,r=!0;break;default:throw Error(a(161))}16&n.effectTag&&(Be(t,\"\"),n.effectTag&=-17);e:t:for(n=e;;){for(;null===n.sibling;){if(null===n.return||vo(n.return)){n=null;break e}n=n.return}for(n.sibling.return=n.return,n=n.sibling;5!==n.tag&&6!==n.tag&&18!==n.tag;){if(2&n.effectTag)continue t;if(null===n.child||4===n.tag)continue t;n.child.return=n,n=n.child}if(!(2&n.effectTag)){n=n.stateNode;break e}}for(var l=e;;){var i=5===l.tag||6===l.tag;if(i){var o=i?l.stateNode:l.stateNode.instance;if(n)if(r){var u=o;o=n,8===(i=t).nodeType?i.parentNode.insertBefore(u,o):i.insertBefore(u,o)}else t.insertBefore(o,n);else r?(8===(u=t).nodeType?(i=u.parentNode).insertBefore(o,u):(i=u).appendChild(o),null!==(u=u._reactRootContainer)&&void 0!==u||null!==i.onclick||(i.onclick=Bn)):t.appendChild(o)}else if(4!==l.tag&&null!==l.child){l.child.return=l,l=l.child;continue}if(l===e)break;for(;null===l.sibling;){if(null===l.return||l.return===e)return;l=l.return}l.sibling.return=l.return,l=l.sibling}}function bo(e,t,n){for(var r,l,i=t,o=!1;;){if(!o){o=i.return;e:for(;;){if(null===o)throw Error(a(160));switch(r=o.stateNode,o.tag){case 5:l=!1;break e;case 3:case 4:r=r.containerInfo,l=!0;break e}o=o.return}o=!0}if(5===i.tag||6===i.tag){e:for(var u=e,c=i,s=n,f=c;;)if(ho(u,f,s),null!==f.child&&4!==f.tag)f.child.return=f,f=f.child;else{if(f===c)break;for(;null===f.sibling;){if(null===f.return||f.return===c)break e;f=f.return}f.sibling.return=f.return,f=f.sibling}l?(u=r,c=i.stateNode,8===u.nodeType?u.parentNode.removeChild(c):u.removeChild(c)):r.removeChild(i.stateNode)}else if(4===i.tag){if(null!==i.child){r=i.stateNode.containerInfo,l=!0,i.child.return=i,i=i.child;continue}}else if(ho(e,i,n),null!==i.child){i.child.return=i,i=i.child;continue}if(i===t)break;for(;null===i.sibling;){if(null===i.return||i.return===t)return;4===(i=i.return).tag&&(o=!1)}i.sibling.return=i.return,i=i.sibling}}function wo(e,t){switch(t.tag){case 0:case 11:case 14:case 15:mo(4,8,t);break;case 1:break;case 5:var n=t.stateNode;if(null!=n){var r=t.memoizedProps,l=null!==e?e.memoizedProps:r;e=t.type;var i=t.updateQueue;if(t.updateQueue=null,null!==i){for(n[ar]=r,\"input\"===e&&\"radio\"===r.type&&null!=r.name&&Pe(n,r),Wn(e,l),t=Wn(e,r),l=0;l<i.length;l+=2){var o=i[l],u=i[l+1];\"style\"===o?jn(n,u):\"dangerouslySetInnerHTML\"===o?$e(n,u):\"children\"===o?Be(n,u):Ee(n,o,u,t)}switch(e){case\"input\":Ne(n,r);break;case\"textarea\":Ue(n,r);break;case\"select\":t=n._wrapperState.wasMultiple,n._wrapperState.wasMultiple=!!r.multiple,null!=(e=r.value)?Re(n,!!r.multiple,e,!1):t!==!!r.multiple&&(null!=r.defaultValue?Re(n,!!r.multiple,r.defaultValue,!0):Re(n,!!r.multiple,r.multiple?[]:\"\",!1))}}}break;case 6:if(null===t.stateNode)throw Error(a(162));t.stateNode.nodeValue=t.memoizedProps;break;case 3:(t=t.stateNode).hydrate&&(t.hydrate=!1,Ct(t.containerInfo));break;case 12:break;case 13:if(n=t,null===t.memoizedState?r=!1:(r=!0,n=t.child,Ao=Vl()),null!==n)e:for(e=n;;){if(5===e.tag)i=e.stateNode,r?\"function\"===typeof(i=i.style).setProperty?i.setProperty(\"display\",\"none\",\"important\"):i.display=\"none\":(i=e.stateNode,l=void 0!==(l=e.memoizedProps.style)&&null!==l&&l.hasOwnProperty(\"display\")?l.display:null,i.style.display=Ln(\"display\",l));else if(6===e.tag)e.stateNode.nodeValue=r?\"\":e.memoizedProps;else{if(13===e.tag&&null!==e.memoizedState&&null===e.memoizedState.dehydrated){(i=e.child.sibling).return=e,e=i;continue}if(null!==e.child){e.child.return=e,e=e.child;continue}}if(e===n)break e;for(;null===e.sibling;){if(null===e.return||e.return===n)break e;e=e.return}e.sibling.return=e.return,e=e.sibling}ko(t);break;case 19:ko(t);break;case 17:case 20:case 21:break;default:throw Error(a(163))}}function ko(e){var t=e.updateQueue;if(null!==t){e.updateQueue=null;var n=e.stateNode;null===n&&(n=e.stateNode=new co),t.forEach((function(t){var r=Cu.bind(null,e,t);n.has(t)||(n.add(t),t.then(r,r))}))}}var Eo=\"function\"===typeof WeakMap?WeakMap:Map;function xo(e,t,n){(n=fi(n,null)).tag=3,n.payload={element:null};var r=t.value;return n.callback=function(){Wo||(Wo=!0,$o=r),so(e,t)},n}function To(e,t,n){(n=fi(n,null)).tag=3;var r=e.type.getDerivedStateFromError;if(\"function\"===typeof r){var l=t.value;n.payload=function(){return so(e,t),r(l)}}var i=e.stateNode;return null!==i&&\"function\"===typeof i.componentDidCatch&&(n.callback=function(){\"function\"!==typeof r&&(null===Bo?Bo=new Set([this]):Bo.add(this),so(e,t));var n=t.stack;this.componentDidCatch(t.value,{componentStack:null!==n?n:\"\"})}),n}var So,Co=Math.ceil,_o=R.ReactCurrentDispatcher,Po=R.ReactCurrentOwner,No=0,Oo=null,zo=null,Mo=0,Ro=0,Io=null,Fo=1073741823,Uo=1073741823,Do=null,Lo=0,jo=!1,Ao=0,Vo=null,Wo=!1,$o=null,Bo=null,Ho=!1,Qo=null,Ko=90,qo=null,Yo=0,Xo=null,Go=0;function Jo(){return 0!==(48&No)?1073741821-(Vl()/10|0):0!==Go?Go:Go=1073741821-(Vl()/10|0)}function Zo(e,t,n){if(0===(2&(t=t.mode)))return 1073741823;var r=Wl();if(0===(4&t))return 99===r?1073741823:1073741822;if(0!==(16&No))return Mo;if(null!==n)e=Xl(e,0|n.timeoutMs||5e3,250);else switch(r){case 99:e=1073741823;break;case 98:e=Xl(e,150,100);break;case 97:case 96:e=Xl(e,5e3,250);break;case 95:e=2;break;default:throw Error(a(326))}return null!==Oo&&e===Mo&&--e,e}function eu(e,t){if(50<Yo)throw Yo=0,Xo=null,Error(a(185));if(null!==(e=tu(e,t))){var n=Wl();1073741823===t?0!==(8&No)&&0===(48&No)?iu(e):(ru(e),0===No&&Kl()):ru(e),0===(4&No)||98!==n&&99!==n||(null===qo?qo=new Map([[e,t]]):(void 0===(n=qo.get(e))||n>t)&&qo.set(e,t))}}function tu(e,t){e.expirationTime<t&&(e.expirationTime=t);var n=e.alternate;null!==n&&n.expirationTime<t&&(n.expirationTime=t);var r=e.return,l=null;if(null===r&&3===e.tag)l=e.stateNode;else for(;null!==r;){if(n=r.alternate,r.childExpirationTime<t&&(r.childExpirationTime=t),null!==n&&n.childExpirationTime<t&&(n.childExpirationTime=t),null===r.return&&3===r.tag){l=r.stateNode;break}r=r.return}return null!==l&&(Oo===l&&(du(t),4===Ro&&ju(l,Mo)),Au(l,t)),l}function nu(e){var t=e.lastExpiredTime;return 0!==t?t:Lu(e,t=e.firstPendingTime)?(t=e.lastPingedTime)>(e=e.nextKnownPendingLevel)?t:e:t}function ru(e){if(0!==e.lastExpiredTime)e.callbackExpirationTime=1073741823,e.callbackPriority=99,e.callbackNode=Ql(iu.bind(null,e));else{var t=nu(e),n=e.callbackNode;if(0===t)null!==n&&(e.callbackNode=null,e.callbackExpirationTime=0,e.callbackPriority=90);else{var r=Jo();if(1073741823===t?r=99:1===t||2===t?r=95:r=0>=(r=10*(1073741821-t)-10*(1073741821-r))?99:250>=r?98:5250>=r?97:95,null!==n){var l=e.callbackPriority;if(e.callbackExpirationTime===t&&l>=r)return;n!==Fl&&Sl(n)}e.callbackExpirationTime=t,e.callbackPriority=r,t=1073741823===t?Ql(iu.bind(null,e)):Hl(r,lu.bind(null,e),{timeout:10*(1073741821-t)-Vl()}),e.callbackNode=t}}}function lu(e,t){if(Go=0,t)return Vu(e,t=Jo()),ru(e),null;var n=nu(e);if(0!==n){if(t=e.callbackNode,0!==(48&No))throw Error(a(327));if(ku(),e===Oo&&n===Mo||uu(e,n),null!==zo){var r=No;No|=16;for(var l=su();;)try{mu();break}catch(u){cu(e,u)}if(ni(),No=r,_o.current=l,1===Ro)throw t=Io,uu(e,n),ju(e,n),ru(e),t;if(null===zo)switch(l=e.finishedWork=e.current.alternate,e.finishedExpirationTime=n,r=Ro,Oo=null,r){case 0:case 1:throw Error(a(345));case 2:Vu(e,2<n?2:n);break;case 3:if(ju(e,n),n===(r=e.lastSuspendedTime)&&(e.nextKnownPendingLevel=vu(l)),1073741823===Fo&&10<(l=Ao+500-Vl())){if(jo){var i=e.lastPingedTime;if(0===i||i>=n){e.lastPingedTime=n,uu(e,n);break}}if(0!==(i=nu(e))&&i!==n)break;if(0!==r&&r!==n){e.lastPingedTime=r;break}e.timeoutHandle=er(gu.bind(null,e),l);break}gu(e);break;case 4:if(ju(e,n),n===(r=e.lastSuspendedTime)&&(e.nextKnownPendingLevel=vu(l)),jo&&(0===(l=e.lastPingedTime)||l>=n)){e.lastPingedTime=n,uu(e,n);break}if(0!==(l=nu(e))&&l!==n)break;if(0!==r&&r!==n){e.lastPingedTime=r;break}if(1073741823!==Uo?r=10*(1073741821-Uo)-Vl():1073741823===Fo?r=0:(r=10*(1073741821-Fo)-5e3,0>(r=(l=Vl())-r)&&(r=0),(n=10*(1073741821-n)-l)<(r=(120>r?120:480>r?480:1080>r?1080:1920>r?1920:3e3>r?3e3:4320>r?4320:1960*Co(r/1960))-r)&&(r=n)),10<r){e.timeoutHandle=er(gu.bind(null,e),r);break}gu(e);break;case 5:if(1073741823!==Fo&&null!==Do){i=Fo;var o=Do;if(0>=(r=0|o.busyMinDurationMs)?r=0:(l=0|o.busyDelayMs,r=(i=Vl()-(10*(1073741821-i)-(0|o.timeoutMs||5e3)))<=l?0:l+r-i),10<r){ju(e,n),e.timeoutHandle=er(gu.bind(null,e),r);break}}gu(e);break;default:throw Error(a(329))}if(ru(e),e.callbackNode===t)return lu.bind(null,e)}}return null}function iu(e){var t=e.lastExpiredTime;if(t=0!==t?t:1073741823,e.finishedExpirationTime===t)gu(e);else{if(0!==(48&No))throw Error(a(327));if(ku(),e===Oo&&t===Mo||uu(e,t),null!==zo){var n=No;No|=16;for(var r=su();;)try{pu();break}catch(l){cu(e,l)}if(ni(),No=n,_o.current=r,1===Ro)throw n=Io,uu(e,t),ju(e,t),ru(e),n;if(null!==zo)throw Error(a(261));e.finishedWork=e.current.alternate,e.finishedExpirationTime=t,Oo=null,gu(e),ru(e)}}return null}function au(e,t){var n=No;No|=1;try{return e(t)}finally{0===(No=n)&&Kl()}}function ou(e,t){var n=No;No&=-2,No|=8;try{return e(t)}finally{0===(No=n)&&Kl()}}function uu(e,t){e.finishedWork=null,e.finishedExpirationTime=0;var n=e.timeoutHandle;if(-1!==n&&(e.timeoutHandle=-1,tr(n)),null!==zo)for(n=zo.return;null!==n;){var r=n;switch(r.tag){case 1:var l=r.type.childContextTypes;null!==l&&void 0!==l&&vl();break;case 3:Ai(),gl();break;case 5:Wi(r);break;case 4:Ai();break;case 13:case 19:cl($i);break;case 10:li(r)}n=n.return}Oo=e,zo=Mu(e.current,null),Mo=t,Ro=0,Io=null,Uo=Fo=1073741823,Do=null,Lo=0,jo=!1}function cu(e,t){for(;;){try{if(ni(),sa(),null===zo||null===zo.return)return Ro=1,Io=t,null;e:{var n=e,r=zo.return,l=zo,i=t;if(t=Mo,l.effectTag|=2048,l.firstEffect=l.lastEffect=null,null!==i&&\"object\"===typeof i&&\"function\"===typeof i.then){var a=i,o=0!==(1&$i.current),u=r;do{var c;if(c=13===u.tag){var s=u.memoizedState;if(null!==s)c=null!==s.dehydrated;else{var f=u.memoizedProps;c=void 0!==f.fallback&&(!0!==f.unstable_avoidThisFallback||!o)}}if(c){var d=u.updateQueue;if(null===d){var p=new Set;p.add(a),u.updateQueue=p}else d.add(a);if(0===(2&u.mode)){if(u.effectTag|=64,l.effectTag&=-2981,1===l.tag)if(null===l.alternate)l.tag=17;else{var m=fi(1073741823,null);m.tag=2,pi(l,m)}l.expirationTime=1073741823;break e}i=void 0,l=t;var h=n.pingCache;if(null===h?(h=n.pingCache=new Eo,i=new Set,h.set(a,i)):void 0===(i=h.get(a))&&(i=new Set,h.set(a,i)),!i.has(l)){i.add(l);var y=Su.bind(null,n,a,l);a.then(y,y)}u.effectTag|=4096,u.expirationTime=t;break e}u=u.return}while(null!==u);i=Error((G(l.type)||\"A React component\")+\" suspended while rendering, but no fallback UI was specified.\\n\\nAdd a <Suspense fallback=...> component higher in the tree to provide a loading indicator or placeholder to display.\"+J(l))}5!==Ro&&(Ro=2),i=uo(i,l),u=r;do{switch(u.tag){case 3:a=i,u.effectTag|=4096,u.expirationTime=t,mi(u,xo(u,a,t));break e;case 1:a=i;var v=u.type,g=u.stateNode;if(0===(64&u.effectTag)&&(\"function\"===typeof v.getDerivedStateFromError||null!==g&&\"function\"===typeof g.componentDidCatch&&(null===Bo||!Bo.has(g)))){u.effectTag|=4096,u.expirationTime=t,mi(u,To(u,a,t));break e}}u=u.return}while(null!==u)}zo=yu(zo)}catch(b){t=b;continue}break}}function su(){var e=_o.current;return _o.current=_a,null===e?_a:e}function fu(e,t){e<Fo&&2<e&&(Fo=e),null!==t&&e<Uo&&2<e&&(Uo=e,Do=t)}function du(e){e>Lo&&(Lo=e)}function pu(){for(;null!==zo;)zo=hu(zo)}function mu(){for(;null!==zo&&!Cl();)zo=hu(zo)}function hu(e){var t=So(e.alternate,e,Mo);return e.memoizedProps=e.pendingProps,null===t&&(t=yu(e)),Po.current=null,t}function yu(e){zo=e;do{var t=zo.alternate;if(e=zo.return,0===(2048&zo.effectTag)){e:{var n=t,r=Mo,i=(t=zo).pendingProps;switch(t.tag){case 2:case 16:break;case 15:case 0:break;case 1:yl(t.type)&&vl();break;case 3:Ai(),gl(),(i=t.stateNode).pendingContext&&(i.context=i.pendingContext,i.pendingContext=null),(null===n||null===n.child)&&Da(t)&&io(t);break;case 5:Wi(t),r=Li(Di.current);var o=t.type;if(null!==n&&null!=t.stateNode)Ga(n,t,o,i,r),n.ref!==t.ref&&(t.effectTag|=128);else if(i){var u=Li(Fi.current);if(Da(t)){var c=(i=t).stateNode;n=i.type;var s=i.memoizedProps,f=r;switch(c[ir]=i,c[ar]=s,o=void 0,r=c,n){case\"iframe\":case\"object\":case\"embed\":Sn(\"load\",r);break;case\"video\":case\"audio\":for(c=0;c<et.length;c++)Sn(et[c],r);break;case\"source\":Sn(\"error\",r);break;case\"img\":case\"image\":case\"link\":Sn(\"error\",r),Sn(\"load\",r);break;case\"form\":Sn(\"reset\",r),Sn(\"submit\",r);break;case\"details\":Sn(\"toggle\",r);break;case\"input\":_e(r,s),Sn(\"invalid\",r),$n(f,\"onChange\");break;case\"select\":r._wrapperState={wasMultiple:!!s.multiple},Sn(\"invalid\",r),$n(f,\"onChange\");break;case\"textarea\":Fe(r,s),Sn(\"invalid\",r),$n(f,\"onChange\")}for(o in Vn(n,s),c=null,s)s.hasOwnProperty(o)&&(u=s[o],\"children\"===o?\"string\"===typeof u?r.textContent!==u&&(c=[\"children\",u]):\"number\"===typeof u&&r.textContent!==\"\"+u&&(c=[\"children\",\"\"+u]):p.hasOwnProperty(o)&&null!=u&&$n(f,o));switch(n){case\"input\":Te(r),Oe(r,s,!0);break;case\"textarea\":Te(r),De(r);break;case\"select\":case\"option\":break;default:\"function\"===typeof s.onClick&&(r.onclick=Bn)}o=c,i.updateQueue=o,(i=null!==o)&&io(t)}else{n=t,f=o,s=i,c=9===r.nodeType?r:r.ownerDocument,u===Le&&(u=Ae(f)),u===Le?\"script\"===f?((s=c.createElement(\"div\")).innerHTML=\"<script><\\/script>\",c=s.removeChild(s.firstChild)):\"string\"===typeof s.is?c=c.createElement(f,{is:s.is}):(c=c.createElement(f),\"select\"===f&&(f=c,s.multiple?f.multiple=!0:s.size&&(f.size=s.size))):c=c.createElementNS(u,f),(s=c)[ir]=n,s[ar]=i,Xa(s,t),t.stateNode=s;var d=r,m=Wn(f=o,n=i);switch(f){case\"iframe\":case\"object\":case\"embed\":Sn(\"load\",s),r=n;break;case\"video\":case\"audio\":for(r=0;r<et.length;r++)Sn(et[r],s);r=n;break;case\"source\":Sn(\"error\",s),r=n;break;case\"img\":case\"image\":case\"link\":Sn(\"error\",s),Sn(\"load\",s),r=n;break;case\"form\":Sn(\"reset\",s),Sn(\"submit\",s),r=n;break;case\"details\":Sn(\"toggle\",s),r=n;break;case\"input\":_e(s,n),r=Ce(s,n),Sn(\"invalid\",s),$n(d,\"onChange\");break;case\"option\":r=Me(s,n);break;case\"select\":s._wrapperState={wasMultiple:!!n.multiple},r=l({},n,{value:void 0}),Sn(\"invalid\",s),$n(d,\"onChange\");break;case\"textarea\":Fe(s,n),r=Ie(s,n),Sn(\"invalid\",s),$n(d,\"onChange\");break;default:r=n}Vn(f,r),c=void 0,u=f;var h=s,y=r;for(c in y)if(y.hasOwnProperty(c)){var v=y[c];\"style\"===c?jn(h,v):\"dangerouslySetInnerHTML\"===c?null!=(v=v?v.__html:void 0)&&$e(h,v):\"children\"===c?\"string\"===typeof v?(\"textarea\"!==u||\"\"!==v)&&Be(h,v):\"number\"===typeof v&&Be(h,\"\"+v):\"suppressContentEditableWarning\"!==c&&\"suppressHydrationWarning\"!==c&&\"autoFocus\"!==c&&(p.hasOwnProperty(c)?null!=v&&$n(d,c):null!=v&&Ee(h,c,v,m))}switch(f){case\"input\":Te(s),Oe(s,n,!1);break;case\"textarea\":Te(s),De(s);break;case\"option\":null!=n.value&&s.setAttribute(\"value\",\"\"+ke(n.value));break;case\"select\":(r=s).multiple=!!n.multiple,null!=(s=n.value)?Re(r,!!n.multiple,s,!1):null!=n.defaultValue&&Re(r,!!n.multiple,n.defaultValue,!0);break;default:\"function\"===typeof r.onClick&&(s.onclick=Bn)}(i=Jn(o,i))&&io(t)}null!==t.ref&&(t.effectTag|=128)}else if(null===t.stateNode)throw Error(a(166));break;case 6:if(n&&null!=t.stateNode)Ja(0,t,n.memoizedProps,i);else{if(\"string\"!==typeof i&&null===t.stateNode)throw Error(a(166));r=Li(Di.current),Li(Fi.current),Da(t)?(o=(i=t).stateNode,r=i.memoizedProps,o[ir]=i,(i=o.nodeValue!==r)&&io(t)):(o=t,(i=(9===r.nodeType?r:r.ownerDocument).createTextNode(i))[ir]=o,t.stateNode=i)}break;case 11:break;case 13:if(cl($i),i=t.memoizedState,0!==(64&t.effectTag)){t.expirationTime=r;break e}i=null!==i,o=!1,null===n?void 0!==t.memoizedProps.fallback&&Da(t):(o=null!==(r=n.memoizedState),i||null===r||null!==(r=n.child.sibling)&&(null!==(s=t.firstEffect)?(t.firstEffect=r,r.nextEffect=s):(t.firstEffect=t.lastEffect=r,r.nextEffect=null),r.effectTag=8)),i&&!o&&0!==(2&t.mode)&&(null===n&&!0!==t.memoizedProps.unstable_avoidThisFallback||0!==(1&$i.current)?0===Ro&&(Ro=3):(0!==Ro&&3!==Ro||(Ro=4),0!==Lo&&null!==Oo&&(ju(Oo,Mo),Au(Oo,Lo)))),(i||o)&&(t.effectTag|=4);break;case 7:case 8:case 12:break;case 4:Ai();break;case 10:li(t);break;case 9:case 14:break;case 17:yl(t.type)&&vl();break;case 19:if(cl($i),null===(i=t.memoizedState))break;if(o=0!==(64&t.effectTag),null===(s=i.rendering)){if(o)ao(i,!1);else if(0!==Ro||null!==n&&0!==(64&n.effectTag))for(n=t.child;null!==n;){if(null!==(s=Bi(n))){for(t.effectTag|=64,ao(i,!1),null!==(o=s.updateQueue)&&(t.updateQueue=o,t.effectTag|=4),null===i.lastEffect&&(t.firstEffect=null),t.lastEffect=i.lastEffect,i=r,o=t.child;null!==o;)n=i,(r=o).effectTag&=2,r.nextEffect=null,r.firstEffect=null,r.lastEffect=null,null===(s=r.alternate)?(r.childExpirationTime=0,r.expirationTime=n,r.child=null,r.memoizedProps=null,r.memoizedState=null,r.updateQueue=null,r.dependencies=null):(r.childExpirationTime=s.childExpirationTime,r.expirationTime=s.expirationTime,r.child=s.child,r.memoizedProps=s.memoizedProps,r.memoizedState=s.memoizedState,r.updateQueue=s.updateQueue,n=s.dependencies,r.dependencies=null===n?null:{expirationTime:n.expirationTime,firstContext:n.firstContext,responders:n.responders}),o=o.sibling;sl($i,1&$i.current|2),t=t.child;break e}n=n.sibling}}else{if(!o)if(null!==(n=Bi(s))){if(t.effectTag|=64,o=!0,null!==(r=n.updateQueue)&&(t.updateQueue=r,t.effectTag|=4),ao(i,!0),null===i.tail&&\"hidden\"===i.tailMode&&!s.alternate){null!==(t=t.lastEffect=i.lastEffect)&&(t.nextEffect=null);break}}else Vl()>i.tailExpiration&&1<r&&(t.effectTag|=64,o=!0,ao(i,!1),t.expirationTime=t.childExpirationTime=r-1);i.isBackwards?(s.sibling=t.child,t.child=s):(null!==(r=i.last)?r.sibling=s:t.child=s,i.last=s)}if(null!==i.tail){0===i.tailExpiration&&(i.tailExpiration=Vl()+500),r=i.tail,i.rendering=r,i.tail=r.sibling,i.lastEffect=t.lastEffect,r.sibling=null,i=$i.current,sl($i,i=o?1&i|2:1&i),t=r;break e}break;case 20:case 21:break;default:throw Error(a(156,t.tag))}t=null}if(i=zo,1===Mo||1!==i.childExpirationTime){for(o=0,r=i.child;null!==r;)(n=r.expirationTime)>o&&(o=n),(s=r.childExpirationTime)>o&&(o=s),r=r.sibling;i.childExpirationTime=o}if(null!==t)return t;null!==e&&0===(2048&e.effectTag)&&(null===e.firstEffect&&(e.firstEffect=zo.firstEffect),null!==zo.lastEffect&&(null!==e.lastEffect&&(e.lastEffect.nextEffect=zo.firstEffect),e.lastEffect=zo.lastEffect),1<zo.effectTag&&(null!==e.lastEffect?e.lastEffect.nextEffect=zo:e.firstEffect=zo,e.lastEffect=zo))}else{if(null!==(t=oo(zo)))return t.effectTag&=2047,t;null!==e&&(e.firstEffect=e.lastEffect=null,e.effectTag|=2048)}if(null!==(t=zo.sibling))return t;zo=e}while(null!==zo);return 0===Ro&&(Ro=5),null}function vu(e){var t=e.expirationTime;return t>(e=e.childExpirationTime)?t:e}function gu(e){var t=Wl();return Bl(99,bu.bind(null,e,t)),null}function bu(e,t){do{ku()}while(null!==Qo);if(0!==(48&No))throw Error(a(327));var n=e.finishedWork,r=e.finishedExpirationTime;if(null===n)return null;if(e.finishedWork=null,e.finishedExpirationTime=0,n===e.current)throw Error(a(177));e.callbackNode=null,e.callbackExpirationTime=0,e.callbackPriority=90,e.nextKnownPendingLevel=0;var l=vu(n);if(e.firstPendingTime=l,r<=e.lastSuspendedTime?e.firstSuspendedTime=e.lastSuspendedTime=e.nextKnownPendingLevel=0:r<=e.firstSuspendedTime&&(e.firstSuspendedTime=r-1),r<=e.lastPingedTime&&(e.lastPingedTime=0),r<=e.lastExpiredTime&&(e.lastExpiredTime=0),e===Oo&&(zo=Oo=null,Mo=0),1<n.effectTag?null!==n.lastEffect?(n.lastEffect.nextEffect=n,l=n.firstEffect):l=n:l=n.firstEffect,null!==l){var i=No;No|=32,Po.current=null,Xn=Tn;var o=qn();if(Yn(o)){if(\"selectionStart\"in o)var u={start:o.selectionStart,end:o.selectionEnd};else e:{var c=(u=(u=o.ownerDocument)&&u.defaultView||window).getSelection&&u.getSelection();if(c&&0!==c.rangeCount){u=c.anchorNode;var s=c.anchorOffset,f=c.focusNode;c=c.focusOffset;try{u.nodeType,f.nodeType}catch(F){u=null;break e}var d=0,p=-1,m=-1,h=0,y=0,v=o,g=null;t:for(;;){for(var b;v!==u||0!==s&&3!==v.nodeType||(p=d+s),v!==f||0!==c&&3!==v.nodeType||(m=d+c),3===v.nodeType&&(d+=v.nodeValue.length),null!==(b=v.firstChild);)g=v,v=b;for(;;){if(v===o)break t;if(g===u&&++h===s&&(p=d),g===f&&++y===c&&(m=d),null!==(b=v.nextSibling))break;g=(v=g).parentNode}v=b}u=-1===p||-1===m?null:{start:p,end:m}}else u=null}u=u||{start:0,end:0}}else u=null;Gn={focusedElem:o,selectionRange:u},Tn=!1,Vo=l;do{try{wu()}catch(F){if(null===Vo)throw Error(a(330));Tu(Vo,F),Vo=Vo.nextEffect}}while(null!==Vo);Vo=l;do{try{for(o=e,u=t;null!==Vo;){var w=Vo.effectTag;if(16&w&&Be(Vo.stateNode,\"\"),128&w){var k=Vo.alternate;if(null!==k){var E=k.ref;null!==E&&(\"function\"===typeof E?E(null):E.current=null)}}switch(1038&w){case 2:go(Vo),Vo.effectTag&=-3;break;case 6:go(Vo),Vo.effectTag&=-3,wo(Vo.alternate,Vo);break;case 1024:Vo.effectTag&=-1025;break;case 1028:Vo.effectTag&=-1025,wo(Vo.alternate,Vo);break;case 4:wo(Vo.alternate,Vo);break;case 8:bo(o,s=Vo,u),yo(s)}Vo=Vo.nextEffect}}catch(F){if(null===Vo)throw Error(a(330));Tu(Vo,F),Vo=Vo.nextEffect}}while(null!==Vo);if(E=Gn,k=qn(),w=E.focusedElem,u=E.selectionRange,k!==w&&w&&w.ownerDocument&&function e(t,n){return!(!t||!n)&&(t===n||(!t||3!==t.nodeType)&&(n&&3===n.nodeType?e(t,n.parentNode):\"contains\"in t?t.contains(n):!!t.compareDocumentPosition&&!!(16&t.compareDocumentPosition(n))))}(w.ownerDocument.documentElement,w)){null!==u&&Yn(w)&&(k=u.start,void 0===(E=u.end)&&(E=k),\"selectionStart\"in w?(w.selectionStart=k,w.selectionEnd=Math.min(E,w.value.length)):(E=(k=w.ownerDocument||document)&&k.defaultView||window).getSelection&&(E=E.getSelection(),s=w.textContent.length,o=Math.min(u.start,s),u=void 0===u.end?o:Math.min(u.end,s),!E.extend&&o>u&&(s=u,u=o,o=s),s=Kn(w,o),f=Kn(w,u),s&&f&&(1!==E.rangeCount||E.anchorNode!==s.node||E.anchorOffset!==s.offset||E.focusNode!==f.node||E.focusOffset!==f.offset)&&((k=k.createRange()).setStart(s.node,s.offset),E.removeAllRanges(),o>u?(E.addRange(k),E.extend(f.node,f.offset)):(k.setEnd(f.node,f.offset),E.addRange(k))))),k=[];for(E=w;E=E.parentNode;)1===E.nodeType&&k.push({element:E,left:E.scrollLeft,top:E.scrollTop});for(\"function\"===typeof w.focus&&w.focus(),w=0;w<k.length;w++)(E=k[w]).element.scrollLeft=E.left,E.element.scrollTop=E.top}Gn=null,Tn=!!Xn,Xn=null,e.current=n,Vo=l;do{try{for(w=r;null!==Vo;){var x=Vo.effectTag;if(36&x){var T=Vo.alternate;switch(E=w,(k=Vo).tag){case 0:case 11:case 15:mo(16,32,k);break;case 1:var S=k.stateNode;if(4&k.effectTag)if(null===T)S.componentDidMount();else{var C=k.elementType===k.type?T.memoizedProps:Gl(k.type,T.memoizedProps);S.componentDidUpdate(C,T.memoizedState,S.__reactInternalSnapshotBeforeUpdate)}var _=k.updateQueue;null!==_&&gi(0,_,S);break;case 3:var P=k.updateQueue;if(null!==P){if(o=null,null!==k.child)switch(k.child.tag){case 5:o=k.child.stateNode;break;case 1:o=k.child.stateNode}gi(0,P,o)}break;case 5:var N=k.stateNode;null===T&&4&k.effectTag&&Jn(k.type,k.memoizedProps)&&N.focus();break;case 6:case 4:case 12:break;case 13:if(null===k.memoizedState){var O=k.alternate;if(null!==O){var z=O.memoizedState;if(null!==z){var M=z.dehydrated;null!==M&&Ct(M)}}}break;case 19:case 17:case 20:case 21:break;default:throw Error(a(163))}}if(128&x){k=void 0;var R=Vo.ref;if(null!==R){var I=Vo.stateNode;switch(Vo.tag){case 5:k=I;break;default:k=I}\"function\"===typeof R?R(k):R.current=k}}Vo=Vo.nextEffect}}catch(F){if(null===Vo)throw Error(a(330));Tu(Vo,F),Vo=Vo.nextEffect}}while(null!==Vo);Vo=null,Ul(),No=i}else e.current=n;if(Ho)Ho=!1,Qo=e,Ko=t;else for(Vo=l;null!==Vo;)t=Vo.nextEffect,Vo.nextEffect=null,Vo=t;if(0===(t=e.firstPendingTime)&&(Bo=null),1073741823===t?e===Xo?Yo++:(Yo=0,Xo=e):Yo=0,\"function\"===typeof _u&&_u(n.stateNode,r),ru(e),Wo)throw Wo=!1,e=$o,$o=null,e;return 0!==(8&No)?null:(Kl(),null)}function wu(){for(;null!==Vo;){var e=Vo.effectTag;0!==(256&e)&&po(Vo.alternate,Vo),0===(512&e)||Ho||(Ho=!0,Hl(97,(function(){return ku(),null}))),Vo=Vo.nextEffect}}function ku(){if(90!==Ko){var e=97<Ko?97:Ko;return Ko=90,Bl(e,Eu)}}function Eu(){if(null===Qo)return!1;var e=Qo;if(Qo=null,0!==(48&No))throw Error(a(331));var t=No;for(No|=32,e=e.current.firstEffect;null!==e;){try{var n=e;if(0!==(512&n.effectTag))switch(n.tag){case 0:case 11:case 15:mo(128,0,n),mo(0,64,n)}}catch(r){if(null===e)throw Error(a(330));Tu(e,r)}n=e.nextEffect,e.nextEffect=null,e=n}return No=t,Kl(),!0}function xu(e,t,n){pi(e,t=xo(e,t=uo(n,t),1073741823)),null!==(e=tu(e,1073741823))&&ru(e)}function Tu(e,t){if(3===e.tag)xu(e,e,t);else for(var n=e.return;null!==n;){if(3===n.tag){xu(n,e,t);break}if(1===n.tag){var r=n.stateNode;if(\"function\"===typeof n.type.getDerivedStateFromError||\"function\"===typeof r.componentDidCatch&&(null===Bo||!Bo.has(r))){pi(n,e=To(n,e=uo(t,e),1073741823)),null!==(n=tu(n,1073741823))&&ru(n);break}}n=n.return}}function Su(e,t,n){var r=e.pingCache;null!==r&&r.delete(t),Oo===e&&Mo===n?4===Ro||3===Ro&&1073741823===Fo&&Vl()-Ao<500?uu(e,Mo):jo=!0:Lu(e,n)&&(0!==(t=e.lastPingedTime)&&t<n||(e.lastPingedTime=n,e.finishedExpirationTime===n&&(e.finishedExpirationTime=0,e.finishedWork=null),ru(e)))}function Cu(e,t){var n=e.stateNode;null!==n&&n.delete(t),0===(t=0)&&(t=Zo(t=Jo(),e,null)),null!==(e=tu(e,t))&&ru(e)}So=function(e,t,n){var r=t.expirationTime;if(null!==e){var l=t.pendingProps;if(e.memoizedProps!==l||pl.current)Aa=!0;else{if(r<n){switch(Aa=!1,t.tag){case 3:Ya(t),La();break;case 5:if(Vi(t),4&t.mode&&1!==n&&l.hidden)return t.expirationTime=t.childExpirationTime=1,null;break;case 1:yl(t.type)&&kl(t);break;case 4:ji(t,t.stateNode.containerInfo);break;case 10:ri(t,t.memoizedProps.value);break;case 13:if(null!==t.memoizedState)return 0!==(r=t.child.childExpirationTime)&&r>=n?eo(e,t,n):(sl($i,1&$i.current),null!==(t=lo(e,t,n))?t.sibling:null);sl($i,1&$i.current);break;case 19:if(r=t.childExpirationTime>=n,0!==(64&e.effectTag)){if(r)return ro(e,t,n);t.effectTag|=64}if(null!==(l=t.memoizedState)&&(l.rendering=null,l.tail=null),sl($i,$i.current),!r)return null}return lo(e,t,n)}Aa=!1}}else Aa=!1;switch(t.expirationTime=0,t.tag){case 2:if(r=t.type,null!==e&&(e.alternate=null,t.alternate=null,t.effectTag|=2),e=t.pendingProps,l=hl(t,dl.current),ai(t,n),l=ca(null,t,r,e,l,n),t.effectTag|=1,\"object\"===typeof l&&null!==l&&\"function\"===typeof l.render&&void 0===l.$$typeof){if(t.tag=1,sa(),yl(r)){var i=!0;kl(t)}else i=!1;t.memoizedState=null!==l.state&&void 0!==l.state?l.state:null;var o=r.getDerivedStateFromProps;\"function\"===typeof o&&Ei(t,r,o,e),l.updater=xi,t.stateNode=l,l._reactInternalFiber=t,_i(t,r,e,n),t=qa(null,t,r,!0,i,n)}else t.tag=0,Va(null,t,l,n),t=t.child;return t;case 16:if(l=t.elementType,null!==e&&(e.alternate=null,t.alternate=null,t.effectTag|=2),e=t.pendingProps,function(e){if(-1===e._status){e._status=0;var t=e._ctor;t=t(),e._result=t,t.then((function(t){0===e._status&&(t=t.default,e._status=1,e._result=t)}),(function(t){0===e._status&&(e._status=2,e._result=t)}))}}(l),1!==l._status)throw l._result;switch(l=l._result,t.type=l,i=t.tag=function(e){if(\"function\"===typeof e)return zu(e)?1:0;if(void 0!==e&&null!==e){if((e=e.$$typeof)===B)return 11;if(e===K)return 14}return 2}(l),e=Gl(l,e),i){case 0:t=Qa(null,t,l,e,n);break;case 1:t=Ka(null,t,l,e,n);break;case 11:t=Wa(null,t,l,e,n);break;case 14:t=$a(null,t,l,Gl(l.type,e),r,n);break;default:throw Error(a(306,l,\"\"))}return t;case 0:return r=t.type,l=t.pendingProps,Qa(e,t,r,l=t.elementType===r?l:Gl(r,l),n);case 1:return r=t.type,l=t.pendingProps,Ka(e,t,r,l=t.elementType===r?l:Gl(r,l),n);case 3:if(Ya(t),null===(r=t.updateQueue))throw Error(a(282));if(l=null!==(l=t.memoizedState)?l.element:null,vi(t,r,t.pendingProps,null,n),(r=t.memoizedState.element)===l)La(),t=lo(e,t,n);else{if((l=t.stateNode.hydrate)&&(za=nr(t.stateNode.containerInfo.firstChild),Oa=t,l=Ma=!0),l)for(n=Ri(t,null,r,n),t.child=n;n;)n.effectTag=-3&n.effectTag|1024,n=n.sibling;else Va(e,t,r,n),La();t=t.child}return t;case 5:return Vi(t),null===e&&Fa(t),r=t.type,l=t.pendingProps,i=null!==e?e.memoizedProps:null,o=l.children,Zn(r,l)?o=null:null!==i&&Zn(r,i)&&(t.effectTag|=16),Ha(e,t),4&t.mode&&1!==n&&l.hidden?(t.expirationTime=t.childExpirationTime=1,t=null):(Va(e,t,o,n),t=t.child),t;case 6:return null===e&&Fa(t),null;case 13:return eo(e,t,n);case 4:return ji(t,t.stateNode.containerInfo),r=t.pendingProps,null===e?t.child=Mi(t,null,r,n):Va(e,t,r,n),t.child;case 11:return r=t.type,l=t.pendingProps,Wa(e,t,r,l=t.elementType===r?l:Gl(r,l),n);case 7:return Va(e,t,t.pendingProps,n),t.child;case 8:case 12:return Va(e,t,t.pendingProps.children,n),t.child;case 10:e:{if(r=t.type._context,l=t.pendingProps,o=t.memoizedProps,ri(t,i=l.value),null!==o){var u=o.value;if(0===(i=Xr(u,i)?0:0|(\"function\"===typeof r._calculateChangedBits?r._calculateChangedBits(u,i):1073741823))){if(o.children===l.children&&!pl.current){t=lo(e,t,n);break e}}else for(null!==(u=t.child)&&(u.return=t);null!==u;){var c=u.dependencies;if(null!==c){o=u.child;for(var s=c.firstContext;null!==s;){if(s.context===r&&0!==(s.observedBits&i)){1===u.tag&&((s=fi(n,null)).tag=2,pi(u,s)),u.expirationTime<n&&(u.expirationTime=n),null!==(s=u.alternate)&&s.expirationTime<n&&(s.expirationTime=n),ii(u.return,n),c.expirationTime<n&&(c.expirationTime=n);break}s=s.next}}else o=10===u.tag&&u.type===t.type?null:u.child;if(null!==o)o.return=u;else for(o=u;null!==o;){if(o===t){o=null;break}if(null!==(u=o.sibling)){u.return=o.return,o=u;break}o=o.return}u=o}}Va(e,t,l.children,n),t=t.child}return t;case 9:return l=t.type,r=(i=t.pendingProps).children,ai(t,n),r=r(l=oi(l,i.unstable_observedBits)),t.effectTag|=1,Va(e,t,r,n),t.child;case 14:return i=Gl(l=t.type,t.pendingProps),$a(e,t,l,i=Gl(l.type,i),r,n);case 15:return Ba(e,t,t.type,t.pendingProps,r,n);case 17:return r=t.type,l=t.pendingProps,l=t.elementType===r?l:Gl(r,l),null!==e&&(e.alternate=null,t.alternate=null,t.effectTag|=2),t.tag=1,yl(r)?(e=!0,kl(t)):e=!1,ai(t,n),Si(t,r,l),_i(t,r,l,n),qa(null,t,r,!0,e,n);case 19:return ro(e,t,n)}throw Error(a(156,t.tag))};var _u=null,Pu=null;function Nu(e,t,n,r){this.tag=e,this.key=n,this.sibling=this.child=this.return=this.stateNode=this.type=this.elementType=null,this.index=0,this.ref=null,this.pendingProps=t,this.dependencies=this.memoizedState=this.updateQueue=this.memoizedProps=null,this.mode=r,this.effectTag=0,this.lastEffect=this.firstEffect=this.nextEffect=null,this.childExpirationTime=this.expirationTime=0,this.alternate=null}function Ou(e,t,n,r){return new Nu(e,t,n,r)}function zu(e){return!(!(e=e.prototype)||!e.isReactComponent)}function Mu(e,t){var n=e.alternate;return null===n?((n=Ou(e.tag,t,e.key,e.mode)).elementType=e.elementType,n.type=e.type,n.stateNode=e.stateNode,n.alternate=e,e.alternate=n):(n.pendingProps=t,n.effectTag=0,n.nextEffect=null,n.firstEffect=null,n.lastEffect=null),n.childExpirationTime=e.childExpirationTime,n.expirationTime=e.expirationTime,n.child=e.child,n.memoizedProps=e.memoizedProps,n.memoizedState=e.memoizedState,n.updateQueue=e.updateQueue,t=e.dependencies,n.dependencies=null===t?null:{expirationTime:t.expirationTime,firstContext:t.firstContext,responders:t.responders},n.sibling=e.sibling,n.index=e.index,n.ref=e.ref,n}function Ru(e,t,n,r,l,i){var o=2;if(r=e,\"function\"===typeof e)zu(e)&&(o=1);else if(\"string\"===typeof e)o=5;else e:switch(e){case L:return Iu(n.children,l,i,t);case $:o=8,l|=7;break;case j:o=8,l|=1;break;case A:return(e=Ou(12,n,t,8|l)).elementType=A,e.type=A,e.expirationTime=i,e;case H:return(e=Ou(13,n,t,l)).type=H,e.elementType=H,e.expirationTime=i,e;case Q:return(e=Ou(19,n,t,l)).elementType=Q,e.expirationTime=i,e;default:if(\"object\"===typeof e&&null!==e)switch(e.$$typeof){case V:o=10;break e;case W:o=9;break e;case B:o=11;break e;case K:o=14;break e;case q:o=16,r=null;break e}throw Error(a(130,null==e?e:typeof e,\"\"))}return(t=Ou(o,n,t,l)).elementType=e,t.type=r,t.expirationTime=i,t}function Iu(e,t,n,r){return(e=Ou(7,e,r,t)).expirationTime=n,e}function Fu(e,t,n){return(e=Ou(6,e,null,t)).expirationTime=n,e}function Uu(e,t,n){return(t=Ou(4,null!==e.children?e.children:[],e.key,t)).expirationTime=n,t.stateNode={containerInfo:e.containerInfo,pendingChildren:null,implementation:e.implementation},t}function Du(e,t,n){this.tag=t,this.current=null,this.containerInfo=e,this.pingCache=this.pendingChildren=null,this.finishedExpirationTime=0,this.finishedWork=null,this.timeoutHandle=-1,this.pendingContext=this.context=null,this.hydrate=n,this.callbackNode=null,this.callbackPriority=90,this.lastExpiredTime=this.lastPingedTime=this.nextKnownPendingLevel=this.lastSuspendedTime=this.firstSuspendedTime=this.firstPendingTime=0}function Lu(e,t){var n=e.firstSuspendedTime;return e=e.lastSuspendedTime,0!==n&&n>=t&&e<=t}function ju(e,t){var n=e.firstSuspendedTime,r=e.lastSuspendedTime;n<t&&(e.firstSuspendedTime=t),(r>t||0===n)&&(e.lastSuspendedTime=t),t<=e.lastPingedTime&&(e.lastPingedTime=0),t<=e.lastExpiredTime&&(e.lastExpiredTime=0)}function Au(e,t){t>e.firstPendingTime&&(e.firstPendingTime=t);var n=e.firstSuspendedTime;0!==n&&(t>=n?e.firstSuspendedTime=e.lastSuspendedTime=e.nextKnownPendingLevel=0:t>=e.lastSuspendedTime&&(e.lastSuspendedTime=t+1),t>e.nextKnownPendingLevel&&(e.nextKnownPendingLevel=t))}function Vu(e,t){var n=e.lastExpiredTime;(0===n||n>t)&&(e.lastExpiredTime=t)}function Wu(e,t,n,r){var l=t.current,i=Jo(),o=wi.suspense;i=Zo(i,l,o);e:if(n){t:{if(tt(n=n._reactInternalFiber)!==n||1!==n.tag)throw Error(a(170));var u=n;do{switch(u.tag){case 3:u=u.stateNode.context;break t;case 1:if(yl(u.type)){u=u.stateNode.__reactInternalMemoizedMergedChildContext;break t}}u=u.return}while(null!==u);throw Error(a(171))}if(1===n.tag){var c=n.type;if(yl(c)){n=wl(n,c,u);break e}}n=u}else n=fl;return null===t.context?t.context=n:t.pendingContext=n,(t=fi(i,o)).payload={element:e},null!==(r=void 0===r?null:r)&&(t.callback=r),pi(l,t),eu(l,i),i}function $u(e){if(!(e=e.current).child)return null;switch(e.child.tag){case 5:default:return e.child.stateNode}}function Bu(e,t){null!==(e=e.memoizedState)&&null!==e.dehydrated&&e.retryTime<t&&(e.retryTime=t)}function Hu(e,t){Bu(e,t),(e=e.alternate)&&Bu(e,t)}function Qu(e,t,n){var r=new Du(e,t,n=null!=n&&!0===n.hydrate),l=Ou(3,null,null,2===t?7:1===t?3:0);r.current=l,l.stateNode=r,e[or]=r.current,n&&0!==t&&function(e){var t=In(e);yt.forEach((function(n){Fn(n,e,t)})),vt.forEach((function(n){Fn(n,e,t)}))}(9===e.nodeType?e:e.ownerDocument),this._internalRoot=r}function Ku(e){return!(!e||1!==e.nodeType&&9!==e.nodeType&&11!==e.nodeType&&(8!==e.nodeType||\" react-mount-point-unstable \"!==e.nodeValue))}function qu(e,t,n,r,l){var i=n._reactRootContainer;if(i){var a=i._internalRoot;if(\"function\"===typeof l){var o=l;l=function(){var e=$u(a);o.call(e)}}Wu(t,a,e,l)}else{if(i=n._reactRootContainer=function(e,t){if(t||(t=!(!(t=e?9===e.nodeType?e.documentElement:e.firstChild:null)||1!==t.nodeType||!t.hasAttribute(\"data-reactroot\"))),!t)for(var n;n=e.lastChild;)e.removeChild(n);return new Qu(e,0,t?{hydrate:!0}:void 0)}(n,r),a=i._internalRoot,\"function\"===typeof l){var u=l;l=function(){var e=$u(a);u.call(e)}}ou((function(){Wu(t,a,e,l)}))}return $u(a)}function Yu(e,t,n){var r=3<arguments.length&&void 0!==arguments[3]?arguments[3]:null;return{$$typeof:D,key:null==r?null:\"\"+r,children:e,containerInfo:t,implementation:n}}function Xu(e,t){var n=2<arguments.length&&void 0!==arguments[2]?arguments[2]:null;if(!Ku(t))throw Error(a(200));return Yu(e,t,null,n)}Qu.prototype.render=function(e,t){Wu(e,this._internalRoot,null,void 0===t?null:t)},Qu.prototype.unmount=function(e){var t=this._internalRoot,n=void 0===e?null:e,r=t.containerInfo;Wu(null,t,null,(function(){r[or]=null,null!==n&&n()}))},it=function(e){if(13===e.tag){var t=Xl(Jo(),150,100);eu(e,t),Hu(e,t)}},at=function(e){if(13===e.tag){Jo();var t=Yl++;eu(e,t),Hu(e,t)}},ot=function(e){if(13===e.tag){var t=Jo();eu(e,t=Zo(t,e,null)),Hu(e,t)}},ee=function(e,t,n){switch(t){case\"input\":if(Ne(e,n),t=n.name,\"radio\"===n.type&&null!=t){for(n=e;n.parentNode;)n=n.parentNode;for(n=n.querySelectorAll(\"input[name=\"+JSON.stringify(\"\"+t)+'][type=\"radio\"]'),t=0;t<n.length;t++){var r=n[t];if(r!==e&&r.form===e.form){var l=fr(r);if(!l)throw Error(a(90));Se(r),Ne(r,l)}}}break;case\"textarea\":Ue(e,n);break;case\"select\":null!=(t=n.value)&&Re(e,!!n.multiple,t,!1)}},ae=au,oe=function(e,t,n,r){var l=No;No|=4;try{return Bl(98,e.bind(null,t,n,r))}finally{0===(No=l)&&Kl()}},ue=function(){0===(49&No)&&(function(){if(null!==qo){var e=qo;qo=null,e.forEach((function(e,t){Vu(t,e),ru(t)})),Kl()}}(),ku())},ce=function(e,t){var n=No;No|=2;try{return e(t)}finally{0===(No=n)&&Kl()}};var Gu={createPortal:Xu,findDOMNode:function(e){if(null==e)return null;if(1===e.nodeType)return e;var t=e._reactInternalFiber;if(void 0===t){if(\"function\"===typeof e.render)throw Error(a(188));throw Error(a(268,Object.keys(e)))}return e=null===(e=lt(t))?null:e.stateNode},hydrate:function(e,t,n){if(!Ku(t))throw Error(a(200));return qu(null,e,t,!0,n)},render:function(e,t,n){if(!Ku(t))throw Error(a(200));return qu(null,e,t,!1,n)},unstable_renderSubtreeIntoContainer:function(e,t,n,r){if(!Ku(n))throw Error(a(200));if(null==e||void 0===e._reactInternalFiber)throw Error(a(38));return qu(e,t,n,!1,r)},unmountComponentAtNode:function(e){if(!Ku(e))throw Error(a(40));return!!e._reactRootContainer&&(ou((function(){qu(null,null,e,!1,(function(){e._reactRootContainer=null,e[or]=null}))})),!0)},unstable_createPortal:function(){return Xu.apply(void 0,arguments)},unstable_batchedUpdates:au,flushSync:function(e,t){if(0!==(48&No))throw Error(a(187));var n=No;No|=1;try{return Bl(99,e.bind(null,t))}finally{No=n,Kl()}},__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED:{Events:[cr,sr,fr,z.injectEventPluginsByName,d,Rt,function(e){_(e,Mt)},le,ie,On,O,ku,{current:!1}]}};!function(e){var t=e.findFiberByHostInstance;(function(e){if(\"undefined\"===typeof __REACT_DEVTOOLS_GLOBAL_HOOK__)return!1;var t=__REACT_DEVTOOLS_GLOBAL_HOOK__;if(t.isDisabled||!t.supportsFiber)return!0;try{var n=t.inject(e);_u=function(e){try{t.onCommitFiberRoot(n,e,void 0,64===(64&e.current.effectTag))}catch(r){}},Pu=function(e){try{t.onCommitFiberUnmount(n,e)}catch(r){}}}catch(r){}})(l({},e,{overrideHookState:null,overrideProps:null,setSuspenseHandler:null,scheduleUpdate:null,currentDispatcherRef:R.ReactCurrentDispatcher,findHostInstanceByFiber:function(e){return null===(e=lt(e))?null:e.stateNode},findFiberByHostInstance:function(e){return t?t(e):null},findHostInstancesForRefresh:null,scheduleRefresh:null,scheduleRoot:null,setRefreshHandler:null,getCurrentFiber:null}))}({findFiberByHostInstance:ur,bundleType:0,version:\"16.12.0\",rendererPackageName:\"react-dom\"});var Ju={default:Gu},Zu=Ju&&Gu||Ju;e.exports=Zu.default||Zu},function(e,t,n){\"use strict\";e.exports=n(16)},function(e,t,n){\"use strict\";var r,l,i,a,o;if(Object.defineProperty(t,\"__esModule\",{value:!0}),\"undefined\"===typeof window||\"function\"!==typeof MessageChannel){var u=null,c=null,s=function e(){if(null!==u)try{var n=t.unstable_now();u(!0,n),u=null}catch(r){throw setTimeout(e,0),r}},f=Date.now();t.unstable_now=function(){return Date.now()-f},r=function(e){null!==u?setTimeout(r,0,e):(u=e,setTimeout(s,0))},l=function(e,t){c=setTimeout(e,t)},i=function(){clearTimeout(c)},a=function(){return!1},o=t.unstable_forceFrameRate=function(){}}else{var d=window.performance,p=window.Date,m=window.setTimeout,h=window.clearTimeout;if(\"undefined\"!==typeof console){var y=window.cancelAnimationFrame;\"function\"!==typeof window.requestAnimationFrame&&console.error(\"This browser doesn't support requestAnimationFrame. Make sure that you load a polyfill in older browsers. https://fb.me/react-polyfills\"),\"function\"!==typeof y&&console.error(\"This browser doesn't support cancelAnimationFrame. Make sure that you load a polyfill in older browsers. https://fb.me/react-polyfills\")}if(\"object\"===typeof d&&\"function\"===typeof d.now)t.unstable_now=function(){return d.now()};else{var v=p.now();t.unstable_now=function(){return p.now()-v}}var g=!1,b=null,w=-1,k=5,E=0;a=function(){return t.unstable_now()>=E},o=function(){},t.unstable_forceFrameRate=function(e){0>e||125<e?console.error(\"forceFrameRate takes a positive int between 0 and 125, forcing framerates higher than 125 fps is not unsupported\"):k=0<e?Math.floor(1e3/e):5};var x=new MessageChannel,T=x.port2;x.port1.onmessage=function(){if(null!==b){var e=t.unstable_now();E=e+k;try{b(!0,e)?T.postMessage(null):(g=!1,b=null)}catch(n){throw T.postMessage(null),n}}else g=!1},r=function(e){b=e,g||(g=!0,T.postMessage(null))},l=function(e,n){w=m((function(){e(t.unstable_now())}),n)},i=function(){h(w),w=-1}}function S(e,t){var n=e.length;e.push(t);e:for(;;){var r=Math.floor((n-1)/2),l=e[r];if(!(void 0!==l&&0<P(l,t)))break e;e[r]=t,e[n]=l,n=r}}function C(e){return void 0===(e=e[0])?null:e}function _(e){var t=e[0];if(void 0!==t){var n=e.pop();if(n!==t){e[0]=n;e:for(var r=0,l=e.length;r<l;){var i=2*(r+1)-1,a=e[i],o=i+1,u=e[o];if(void 0!==a&&0>P(a,n))void 0!==u&&0>P(u,a)?(e[r]=u,e[o]=n,r=o):(e[r]=a,e[i]=n,r=i);else{if(!(void 0!==u&&0>P(u,n)))break e;e[r]=u,e[o]=n,r=o}}}return t}return null}function P(e,t){var n=e.sortIndex-t.sortIndex;return 0!==n?n:e.id-t.id}var N=[],O=[],z=1,M=null,R=3,I=!1,F=!1,U=!1;function D(e){for(var t=C(O);null!==t;){if(null===t.callback)_(O);else{if(!(t.startTime<=e))break;_(O),t.sortIndex=t.expirationTime,S(N,t)}t=C(O)}}function L(e){if(U=!1,D(e),!F)if(null!==C(N))F=!0,r(j);else{var t=C(O);null!==t&&l(L,t.startTime-e)}}function j(e,n){F=!1,U&&(U=!1,i()),I=!0;var r=R;try{for(D(n),M=C(N);null!==M&&(!(M.expirationTime>n)||e&&!a());){var o=M.callback;if(null!==o){M.callback=null,R=M.priorityLevel;var u=o(M.expirationTime<=n);n=t.unstable_now(),\"function\"===typeof u?M.callback=u:M===C(N)&&_(N),D(n)}else _(N);M=C(N)}if(null!==M)var c=!0;else{var s=C(O);null!==s&&l(L,s.startTime-n),c=!1}return c}finally{M=null,R=r,I=!1}}function A(e){switch(e){case 1:return-1;case 2:return 250;case 5:return 1073741823;case 4:return 1e4;default:return 5e3}}var V=o;t.unstable_ImmediatePriority=1,t.unstable_UserBlockingPriority=2,t.unstable_NormalPriority=3,t.unstable_IdlePriority=5,t.unstable_LowPriority=4,t.unstable_runWithPriority=function(e,t){switch(e){case 1:case 2:case 3:case 4:case 5:break;default:e=3}var n=R;R=e;try{return t()}finally{R=n}},t.unstable_next=function(e){switch(R){case 1:case 2:case 3:var t=3;break;default:t=R}var n=R;R=t;try{return e()}finally{R=n}},t.unstable_scheduleCallback=function(e,n,a){var o=t.unstable_now();if(\"object\"===typeof a&&null!==a){var u=a.delay;u=\"number\"===typeof u&&0<u?o+u:o,a=\"number\"===typeof a.timeout?a.timeout:A(e)}else a=A(e),u=o;return e={id:z++,callback:n,priorityLevel:e,startTime:u,expirationTime:a=u+a,sortIndex:-1},u>o?(e.sortIndex=u,S(O,e),null===C(N)&&e===C(O)&&(U?i():U=!0,l(L,u-o))):(e.sortIndex=a,S(N,e),F||I||(F=!0,r(j))),e},t.unstable_cancelCallback=function(e){e.callback=null},t.unstable_wrapCallback=function(e){var t=R;return function(){var n=R;R=t;try{return e.apply(this,arguments)}finally{R=n}}},t.unstable_getCurrentPriorityLevel=function(){return R},t.unstable_shouldYield=function(){var e=t.unstable_now();D(e);var n=C(N);return n!==M&&null!==M&&null!==n&&null!==n.callback&&n.startTime<=e&&n.expirationTime<M.expirationTime||a()},t.unstable_requestPaint=V,t.unstable_continueExecution=function(){F||I||(F=!0,r(j))},t.unstable_pauseExecution=function(){},t.unstable_getFirstCallbackNode=function(){return C(N)},t.unstable_Profiling=null}]]);\n//# sourceMappingURL=2.21b0a377.chunk.js.map";
-
-
-#endif
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "server.h"
-#include "files.h"
+#include "assets.h"
+#include "websocket_session.h"
 
 #include <esp_http_server.h>
+#include <esp_partition.h>
 #include <esp_log.h>
 
 #include <string.h>
@@ -11,45 +13,53 @@
 
 #define TAG "webserver"
 
-#define MAIN_JS_ID 1
-#define INDEX_JS_ID 2
-#define CHUNK_JS_ID 3
+// roughly one tcp segment per chunk
+#define CHUNK_SIZE 1436
+#define ACCEPT_ENCODING_SIZE 64
+#define IF_NONE_MATCH_SIZE 96
 
 static esp_err_t send_file(httpd_req_t *request);
+static const web_asset *find_asset(const char *uri, bool accepts_gzip);
+static bool accepts_gzip(httpd_req_t *request);
+static bool is_cached(httpd_req_t *request, const web_asset *asset);
+static esp_err_t load_assets();
 
-httpd_uri_t index_html_uri = {
-    .uri = "/",
-    // .uri = "/index.html",
-    .method = HTTP_GET,
-    .handler = send_file,
-    .user_ctx = (void *)INDEX_JS_ID
-};
-
-httpd_uri_t main_js_uri = {
-    .uri = "/main.js",
-    .method = HTTP_GET,
-    .handler = send_file,
-    .user_ctx = (void *)MAIN_JS_ID
-};
-
-httpd_uri_t chunk_js_uri = {
-    .uri = "/chunk.js",
-    .method = HTTP_GET,
-    .handler = send_file,
-    .user_ctx = (void *)CHUNK_JS_ID
-};
+static const esp_partition_t *partition = NULL;
+static web_asset assets[WEB_ASSETS_MAX];
+static int total_assets = 0;
+static httpd_uri_t asset_uris[WEB_ASSETS_MAX];
+// only the httpd task sends files, so one buffer is enough
+static uint8_t chunk[CHUNK_SIZE];
 
 httpd_handle_t start_webserver(uint32_t port) {
     httpd_handle_t server = NULL;
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.server_port = port;
+    config.max_open_sockets = WEBSERVER_MAX_SOCKETS;
+    config.lru_purge_enable = true;
+    // leaves upgraded sockets open for the websocket session task
+    config.close_fn = websocket_session_close_fn;
 
     // Start the httpd server
     ESP_LOGI(TAG, "Starting server on port: '%d'", config.server_port);
     if (httpd_start(&server, &config) == ESP_OK) {
-        httpd_register_uri_handler(server, &index_html_uri);
-        httpd_register_uri_handler(server, &main_js_uri);
-        httpd_register_uri_handler(server, &chunk_js_uri);
+        // without the ui the websocket api is still served
+        if (load_assets() != ESP_OK) {
+            ESP_LOGE(TAG, "No web ui found, flash it with make www-flash");
+        }
+        // assets may be listed once per encoding, register each uri once
+        int total_uris = 0;
+        for (int i = 0; i < total_assets; i++) {
+            if (i > 0 && strcmp(assets[i].uri, assets[i-1].uri) == 0) {
+                continue;
+            }
+            httpd_uri_t *uri = &asset_uris[total_uris++];
+            uri->uri = assets[i].uri;
+            uri->method = HTTP_GET;
+            uri->handler = send_file;
+            uri->user_ctx = NULL;
+            httpd_register_uri_handler(server, uri);
+        }
         return server;
     }
 
@@ -58,21 +68,117 @@ httpd_handle_t start_webserver(uint32_t port) {
 }
 
 esp_err_t send_file(httpd_req_t *request) {
-    int fileID = (int)(request->user_ctx);
-    switch (fileID) {
-    case MAIN_JS_ID:
-        httpd_resp_send(request, main_js_file, sizeof(main_js_file));
-        break;
-    case CHUNK_JS_ID:
-        httpd_resp_send(request, chunk_js_file, sizeof(chunk_js_file));
-        break;
-    case INDEX_JS_ID:
-        httpd_resp_send(request, index_js_file, sizeof(index_js_file));
-        break;
-    default:
-        httpd_resp_send_404(request);
-        break;
+    // gzip when the client takes it, the identity copy otherwise
+    const web_asset *asset = find_asset(request->uri, accepts_gzip(request));
+    if (asset == NULL) {
+        // only an image built with --gzip-only lacks the identity copy
+        httpd_resp_set_status(request, "406 Not Acceptable");
+        httpd_resp_send(request, "Client must accept gzip encoding", -1);
+        return ESP_OK;
     }
 
+    httpd_resp_set_hdr(request, "ETag", asset->etag);
+    httpd_resp_set_hdr(request, "Cache-Control", asset->cache_control);
+    httpd_resp_set_hdr(request, "Vary", "Accept-Encoding");
+    if (is_cached(request, asset)) {
+        httpd_resp_set_status(request, "304 Not Modified");
+        return httpd_resp_send(request, NULL, 0);
+    }
+
+    httpd_resp_set_type(request, asset->content_type);
+    if (asset->encoding == WEB_ASSET_GZIP) {
+        httpd_resp_set_hdr(request, "Content-Encoding", "gzip");
+    }
+
+    // stream from the partition a chunk at a time instead of one large send
+    for (size_t offset = 0; offset < asset->length; offset += CHUNK_SIZE) {
+        size_t length = MIN(CHUNK_SIZE, asset->length - offset);
+        if (esp_partition_read(partition, asset->offset + offset, chunk, length) != ESP_OK) {
+            ESP_LOGE(TAG, "Failed reading %s", asset->uri);
+            return ESP_FAIL;
+        }
+        if (httpd_resp_send_chunk(request, (const char *)chunk, length) != ESP_OK) {
+            ESP_LOGE(TAG, "Failed sending %s", asset->uri);
+            return ESP_FAIL;
+        }
+    }
+    return httpd_resp_send_chunk(request, NULL, 0);
+}
+
+const web_asset *find_asset(const char *uri, bool gzip) {
+    // ignore any query string
+    size_t uri_length = strcspn(uri, "?");
+    const web_asset *identity = NULL;
+    for (int i = 0; i < total_assets; i++) {
+        const web_asset *asset = &assets[i];
+        if (strlen(asset->uri) != uri_length || strncmp(asset->uri, uri, uri_length) != 0) {
+            continue;
+        }
+        if (asset->encoding == WEB_ASSET_GZIP && gzip) {
+            return asset;
+        }
+        if (asset->encoding == WEB_ASSET_IDENTITY) {
+            identity = asset;
+        }
+    }
+    return identity;
+}
+
+bool accepts_gzip(httpd_req_t *request) {
+    char value[ACCEPT_ENCODING_SIZE];
+    // a truncated header still holds the first encodings listed
+    esp_err_t status = httpd_req_get_hdr_value_str(request, "Accept-Encoding", value, sizeof(value));
+    if (status != ESP_OK && status != ESP_ERR_HTTPD_RESULT_TRUNC) {
+        return false;
+    }
+    return strstr(value, "gzip") != NULL;
+}
+
+bool is_cached(httpd_req_t *request, const web_asset *asset) {
+    char value[IF_NONE_MATCH_SIZE];
+    esp_err_t status = httpd_req_get_hdr_value_str(request, "If-None-Match", value, sizeof(value));
+    if (status != ESP_OK && status != ESP_ERR_HTTPD_RESULT_TRUNC) {
+        return false;
+    }
+    // may be a list of etags, or a wildcard
+    return strstr(value, asset->etag) != NULL || strcmp(value, "*") == 0;
+}
+
+esp_err_t load_assets() {
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, WEB_ASSETS_PARTITION_SUBTYPE, WEB_ASSETS_PARTITION_LABEL);
+    if (partition == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    web_assets_header header;
+    esp_err_t status = esp_partition_read(partition, 0, &header, sizeof(header));
+    if (status != ESP_OK) {
+        return status;
+    }
+    // erased flash reads back as 0xff
+    if (header.magic != WEB_ASSETS_MAGIC || header.count > WEB_ASSETS_MAX || header.length > partition->size) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // only the manifest is kept in ram, file data stays in flash
+    status = esp_partition_read(partition, sizeof(header), assets, header.count * sizeof(web_asset));
+    if (status != ESP_OK) {
+        return status;
+    }
+    for (int i = 0; i < header.count; i++) {
+        if (assets[i].offset > header.length || assets[i].length > header.length - assets[i].offset) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        if (assets[i].encoding != WEB_ASSET_IDENTITY && assets[i].encoding != WEB_ASSET_GZIP) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        // never trust the terminators of what is in flash
+        assets[i].uri[sizeof(assets[i].uri) - 1] = '\0';
+        assets[i].content_type[sizeof(assets[i].content_type) - 1] = '\0';
+        assets[i].etag[sizeof(assets[i].etag) - 1] = '\0';
+        assets[i].cache_control[sizeof(assets[i].cache_control) - 1] = '\0';
+    }
+    total_assets = header.count;
+    ESP_LOGI(TAG, "Serving %d web assets, %d bytes", total_assets, (int)header.length);
     return ESP_OK;
-}
\ No newline at end of file
+}
@@ -3,6 +3,12 @@
 
 #include <esp_http_server.h>
 
+// page loads and websocket handshakes, least recently used is closed when full
+// open websockets are handed to their own task and do not count against it
+#ifndef WEBSERVER_MAX_SOCKETS
+#define WEBSERVER_MAX_SOCKETS 7
+#endif
+
 httpd_handle_t start_webserver(uint32_t port);
 
 #endif
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "websocket.h"
 #include "websocket_handshake.h"
+#include "websocket_io.h"
+#include "websocket_session.h"
 
 #include <esp_http_server.h>
 #include <esp_log.h>
@@ -13,22 +15,15 @@
 
 #define TAG "websocket"
 
-httpd_handle_t start_websocket(uint32_t port) {
-    httpd_handle_t server = NULL;
-    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    config.server_port = port;
-    config.ctrl_port = 32767;
-    config.recv_wait_timeout = 60 * 60 * 1; // 1 hour timeout for recieve
-    config.lru_purge_enable = true;
-
-    // Start the httpd server
-    ESP_LOGI(TAG, "Starting server on port: '%d'", config.server_port);
-    if (httpd_start(&server, &config) == ESP_OK) {
-        return server;
+esp_err_t websocket_register(httpd_handle_t server, const httpd_uri_t *uri) {
+    // websockets share the listening socket of an existing server
+    if (httpd_register_uri_handler(server, uri) != ESP_OK ||
+        websocket_session_init() != ESP_OK) {
+        ESP_LOGE(TAG, "Error registering websocket on '%s'", uri->uri);
+        return ESP_FAIL;
     }
-
-    ESP_LOGI(TAG, "Error starting server!");
-    return NULL;
+    ESP_LOGI(TAG, "Registered websocket on '%s'", uri->uri);
+    return ESP_OK;
 }
 
 
@@ -2,6 +2,9 @@
 #define __WEBSOCKET_H__
 
 #include <esp_http_server.h>
+#include <stdbool.h>
+
+#include "websocket_parser.h"
 
 #define WEBSOCKET_OPCODE_CONTINUATION 0x00
 #define WEBSOCKET_OPCODE_TEXT 0x01
@@ -10,9 +13,36 @@
 #define WEBSOCKET_OPCODE_PONG 0x0A
 #define WEBSOCKET_OPCODE_CLOSE 0x08
 
-typedef esp_err_t (*websocket_recieve_callback) (httpd_req_t *, uint8_t opcode, uint8_t *, int);
-typedef esp_err_t (*websocket_start_callback) (httpd_req_t *);
-typedef esp_err_t (*websocket_exit_callback) (httpd_req_t *);
+#define WEBSOCKET_CLOSE_NORMAL 1000
+#define WEBSOCKET_CLOSE_PROTOCOL_ERROR 1002
+#define WEBSOCKET_CLOSE_TOO_BIG 1009
+#define WEBSOCKET_CLOSE_TRY_AGAIN 1013
+
+// every open websocket holds one session, so memory use is fixed
+#ifndef WEBSOCKET_MAX_SESSIONS
+#define WEBSOCKET_MAX_SESSIONS 4
+#endif
+
+struct websocket_ctx;
+
+typedef enum {
+    WEBSOCKET_SESSION_FREE,
+    // reserved for a handshake, httpd still lists the socket
+    WEBSOCKET_SESSION_PENDING,
+    // httpd let go of the socket, the session task owns it
+    WEBSOCKET_SESSION_OPEN,
+} websocket_session_state;
+
+typedef struct websocket_session {
+    websocket_session_state state;
+    int sockfd;
+    struct websocket_ctx *context;
+    websocket_parser parser;
+} websocket_session;
+
+typedef esp_err_t (*websocket_recieve_callback) (websocket_session *, uint8_t opcode, uint8_t *, int);
+typedef esp_err_t (*websocket_start_callback) (websocket_session *);
+typedef esp_err_t (*websocket_exit_callback) (websocket_session *);
 
 typedef struct websocket_ctx {
     websocket_start_callback on_start;
@@ -20,6 +50,7 @@ typedef struct websocket_ctx {
     websocket_exit_callback on_exit;
 } websocket_ctx;
 
-httpd_handle_t start_websocket(uint32_t port);
+// the server must be started with websocket_session_close_fn as its close_fn
+esp_err_t websocket_register(httpd_handle_t server, const httpd_uri_t *uri);
 
 #endif
\ No newline at end of file
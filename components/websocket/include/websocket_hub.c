@@ -0,0 +1,338 @@
+#include "websocket_hub.h"
+#include "websocket_io.h"
+
+#include <esp_log.h>
+
+#include <string.h>
+#include <lwip/sockets.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define TAG "websocket-hub"
+
+// how long to wait before retrying clients whose socket buffer was full
+#define WEBSOCKET_HUB_RETRY_MS 50
+
+// a client is its slot in the low byte and the generation of that slot above it
+// the generation is odd while a client is joined, so a client is never 0
+#define CLIENT(slot, generation) ((((generation) & 0xFFFF) << 8) | (slot))
+#define CLIENT_SLOT(client) ((client) & 0xFF)
+
+typedef struct websocket_hub_frame {
+    uint8_t topic;
+    uint8_t length;
+    uint8_t data[WEBSOCKET_HUB_FRAME_SIZE];
+} websocket_hub_frame;
+
+typedef struct websocket_hub_connection {
+    int sockfd;
+    // changes on every join and leave, so a send that finishes after the
+    // socket left can not touch the queue of a new client with the same fd
+    uint32_t generation;
+    // held for the whole of a frame, only ever by one socket's writers
+    SemaphoreHandle_t send_lock;
+    uint8_t head;
+    uint8_t count;
+    // head frame is partly on the wire and must not be replaced
+    bool in_flight;
+    // bytes of the head frame already written, the rest goes out before anything else
+    uint8_t sent;
+    // send_lock is kept from the first byte of a frame to its last, only the hub task
+    // touches these, the generation is the client the lock was taken for
+    bool locked;
+    uint32_t locked_generation;
+    websocket_hub_frame queue[WEBSOCKET_HUB_QUEUE_LENGTH];
+} websocket_hub_connection;
+
+static websocket_hub_connection connections[WEBSOCKET_HUB_MAX_CONNECTIONS];
+static websocket_hub_stats stats = {0};
+static TaskHandle_t hub_task = NULL;
+
+static void websocket_hub_task(void *ignore);
+static esp_err_t websocket_hub_encode(websocket_hub_frame *frame, uint8_t topic, uint8_t opcode, const uint8_t *data, size_t length);
+static void websocket_hub_enqueue(websocket_hub_connection *connection, const websocket_hub_frame *frame);
+static bool websocket_hub_flush(websocket_hub_connection *connection);
+
+esp_err_t websocket_hub_init() {
+    for (int i = 0; i < WEBSOCKET_HUB_MAX_CONNECTIONS; i++) {
+        connections[i].sockfd = -1;
+        connections[i].count = 0;
+        connections[i].send_lock = xSemaphoreCreateMutex();
+        if (connections[i].send_lock == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    if (xTaskCreate(websocket_hub_task, "ws-hub-task", 2048, NULL, 5, &hub_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start sender task");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t websocket_hub_join(int sockfd, websocket_hub_client *client) {
+    esp_err_t status = ESP_ERR_NO_MEM;
+    websocket_hub_client joined = WEBSOCKET_HUB_NO_CLIENT;
+    portENTER_CRITICAL();
+    for (int i = 0; i < WEBSOCKET_HUB_MAX_CONNECTIONS; i++) {
+        websocket_hub_connection *connection = &connections[i];
+        if (connection->sockfd == -1) {
+            connection->sockfd = sockfd;
+            connection->generation++;
+            connection->head = 0;
+            connection->count = 0;
+            connection->in_flight = false;
+            connection->sent = 0;
+            joined = CLIENT(i, connection->generation);
+            status = ESP_OK;
+            break;
+        }
+    }
+    portEXIT_CRITICAL();
+
+    if (status != ESP_OK) {
+        ESP_LOGE(TAG, "No free slot for socket %d", sockfd);
+    }
+    if (client != NULL) {
+        *client = joined;
+    }
+    return status;
+}
+
+esp_err_t websocket_hub_leave(int sockfd) {
+    esp_err_t status = ESP_ERR_NOT_FOUND;
+    portENTER_CRITICAL();
+    for (int i = 0; i < WEBSOCKET_HUB_MAX_CONNECTIONS; i++) {
+        if (connections[i].sockfd == sockfd) {
+            connections[i].sockfd = -1;
+            connections[i].generation++;
+            connections[i].head = 0;
+            connections[i].count = 0;
+            connections[i].in_flight = false;
+            connections[i].sent = 0;
+            status = ESP_OK;
+            break;
+        }
+    }
+    portEXIT_CRITICAL();
+    return status;
+}
+
+websocket_hub_client websocket_hub_find(int sockfd) {
+    websocket_hub_client client = WEBSOCKET_HUB_NO_CLIENT;
+    portENTER_CRITICAL();
+    for (int i = 0; i < WEBSOCKET_HUB_MAX_CONNECTIONS; i++) {
+        if (connections[i].sockfd == sockfd) {
+            client = CLIENT(i, connections[i].generation);
+            break;
+        }
+    }
+    portEXIT_CRITICAL();
+    return client;
+}
+
+esp_err_t websocket_hub_broadcast(uint8_t topic, uint8_t opcode, const uint8_t *data, size_t length) {
+    if (hub_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // encode once, each connection then costs a single copy into its queue
+    websocket_hub_frame frame;
+    if (websocket_hub_encode(&frame, topic, opcode, data, length) != ESP_OK) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    for (int i = 0; i < WEBSOCKET_HUB_MAX_CONNECTIONS; i++) {
+        portENTER_CRITICAL();
+        if (connections[i].sockfd != -1) {
+            websocket_hub_enqueue(&connections[i], &frame);
+        }
+        portEXIT_CRITICAL();
+    }
+    xTaskNotifyGive(hub_task);
+    return ESP_OK;
+}
+
+esp_err_t websocket_hub_send(websocket_hub_client client, uint8_t topic, uint8_t opcode, const uint8_t *data, size_t length) {
+    if (hub_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (CLIENT_SLOT(client) >= WEBSOCKET_HUB_MAX_CONNECTIONS) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    websocket_hub_frame frame;
+    if (websocket_hub_encode(&frame, topic, opcode, data, length) != ESP_OK) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    esp_err_t status = ESP_ERR_NOT_FOUND;
+    websocket_hub_connection *connection = &connections[CLIENT_SLOT(client)];
+    portENTER_CRITICAL();
+    // a leave or a later join moves the generation on, so a stale client matches nothing
+    if (connection->sockfd != -1 && CLIENT(CLIENT_SLOT(client), connection->generation) == client) {
+        websocket_hub_enqueue(connection, &frame);
+        status = ESP_OK;
+    }
+    portEXIT_CRITICAL();
+    if (status == ESP_OK) {
+        xTaskNotifyGive(hub_task);
+    }
+    return status;
+}
+
+void websocket_hub_get_stats(websocket_hub_stats *out) {
+    portENTER_CRITICAL();
+    *out = stats;
+    portEXIT_CRITICAL();
+}
+
+esp_err_t websocket_hub_lock(int sockfd, TickType_t timeout, SemaphoreHandle_t *lock) {
+    *lock = NULL;
+    portENTER_CRITICAL();
+    for (int i = 0; i < WEBSOCKET_HUB_MAX_CONNECTIONS; i++) {
+        if (connections[i].sockfd == sockfd) {
+            *lock = connections[i].send_lock;
+            break;
+        }
+    }
+    portEXIT_CRITICAL();
+    if (*lock != NULL && xSemaphoreTake(*lock, timeout) != pdTRUE) {
+        *lock = NULL;
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+void websocket_hub_unlock(SemaphoreHandle_t lock) {
+    if (lock != NULL) {
+        xSemaphoreGive(lock);
+    }
+}
+
+esp_err_t websocket_hub_encode(websocket_hub_frame *frame, uint8_t topic, uint8_t opcode, const uint8_t *data, size_t length) {
+    if (length > WEBSOCKET_HUB_MAX_PAYLOAD) {
+        ESP_LOGE(TAG, "Payload of %d bytes too large to queue", (int)length);
+        return ESP_FAIL;
+    }
+    int header_length = websocket_encode_header(frame->data, opcode, length);
+    memcpy(&frame->data[header_length], data, length);
+    frame->length = header_length + length;
+    frame->topic = topic;
+    return ESP_OK;
+}
+
+// must be called inside a critical section
+void websocket_hub_enqueue(websocket_hub_connection *connection, const websocket_hub_frame *frame) {
+    uint8_t first = connection->in_flight ? 1 : 0;
+
+    if (frame->topic != WEBSOCKET_HUB_NO_TOPIC) {
+        for (uint8_t i = first; i < connection->count; i++) {
+            websocket_hub_frame *queued = &connection->queue[(connection->head + i) % WEBSOCKET_HUB_QUEUE_LENGTH];
+            if (queued->topic == frame->topic) {
+                *queued = *frame;
+                stats.coalesced++;
+                return;
+            }
+        }
+    }
+
+    if (connection->count == WEBSOCKET_HUB_QUEUE_LENGTH) {
+        if (!connection->in_flight) {
+            connection->head = (connection->head + 1) % WEBSOCKET_HUB_QUEUE_LENGTH;
+        } else {
+            // the head is being written so drop the one behind it
+            for (uint8_t i = 1; i < connection->count - 1; i++) {
+                connection->queue[(connection->head + i) % WEBSOCKET_HUB_QUEUE_LENGTH] =
+                    connection->queue[(connection->head + i + 1) % WEBSOCKET_HUB_QUEUE_LENGTH];
+            }
+        }
+        connection->count--;
+        stats.dropped++;
+    }
+
+    connection->queue[(connection->head + connection->count) % WEBSOCKET_HUB_QUEUE_LENGTH] = *frame;
+    connection->count++;
+    stats.queued++;
+}
+
+void websocket_hub_task(void *ignore) {
+    bool pending = false;
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, pending ? pdMS_TO_TICKS(WEBSOCKET_HUB_RETRY_MS) : portMAX_DELAY);
+        pending = false;
+        for (int i = 0; i < WEBSOCKET_HUB_MAX_CONNECTIONS; i++) {
+            if (websocket_hub_flush(&connections[i])) {
+                pending = true;
+            }
+        }
+    }
+}
+
+// returns true if frames are left because the client is not keeping up
+bool websocket_hub_flush(websocket_hub_connection *connection) {
+    websocket_hub_frame frame;
+    while (1) {
+        portENTER_CRITICAL();
+        int sockfd = connection->sockfd;
+        uint32_t generation = connection->generation;
+        uint8_t offset = connection->sent;
+        bool has_frame = (sockfd != -1) && (connection->count > 0);
+        if (has_frame) {
+            frame = connection->queue[connection->head];
+            connection->in_flight = true;
+        }
+        portEXIT_CRITICAL();
+
+        // the client that was left with half a frame has gone, so has the rest of it
+        if (connection->locked && (!has_frame || connection->locked_generation != generation)) {
+            xSemaphoreGive(connection->send_lock);
+            connection->locked = false;
+        }
+        if (!has_frame) {
+            return false;
+        }
+
+        // never wait on a slow client, a reply being written to it counts as blocked too
+        if (!connection->locked) {
+            if (xSemaphoreTake(connection->send_lock, 0) != pdTRUE) {
+                portENTER_CRITICAL();
+                if (connection->generation == generation) {
+                    connection->in_flight = false;
+                }
+                portEXIT_CRITICAL();
+                return true;
+            }
+            connection->locked = true;
+            connection->locked_generation = generation;
+        }
+
+        int written = send(sockfd, &frame.data[offset], frame.length - offset, MSG_DONTWAIT);
+        bool would_block = (written < 0) && (errno == EAGAIN || errno == EWOULDBLOCK);
+        if (written > 0) {
+            offset += written;
+        }
+        // sent, or the socket failed and the session will be closed anyway
+        bool done = (written < 0) ? !would_block : (offset == frame.length);
+        // a partly written frame keeps the lock, nothing else may go out in the middle of it
+        if (done || offset == 0) {
+            xSemaphoreGive(connection->send_lock);
+            connection->locked = false;
+        }
+
+        portENTER_CRITICAL();
+        // after a leave the slot belongs to someone else, whatever its fd
+        if (connection->generation == generation) {
+            connection->sent = done ? 0 : offset;
+            connection->in_flight = !done && offset > 0;
+            if (done) {
+                connection->head = (connection->head + 1) % WEBSOCKET_HUB_QUEUE_LENGTH;
+                connection->count--;
+                if (offset == frame.length) {
+                    stats.sent++;
+                }
+            }
+        }
+        portEXIT_CRITICAL();
+
+        if (!done) {
+            return true;
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef __WEBSOCKET_HUB_H__
+#define __WEBSOCKET_HUB_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <esp_err.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "websocket.h"
+
+#ifndef WEBSOCKET_HUB_MAX_CONNECTIONS
+#define WEBSOCKET_HUB_MAX_CONNECTIONS WEBSOCKET_MAX_SESSIONS
+#endif
+
+// outbound frames held per connection before the oldest is dropped
+#ifndef WEBSOCKET_HUB_QUEUE_LENGTH
+#define WEBSOCKET_HUB_QUEUE_LENGTH 8
+#endif
+
+// encoded frame size, header included
+#define WEBSOCKET_HUB_FRAME_SIZE 32
+#define WEBSOCKET_HUB_MAX_PAYLOAD (WEBSOCKET_HUB_FRAME_SIZE - 2)
+
+// queued frames with the same non zero topic are replaced instead of appended
+#define WEBSOCKET_HUB_NO_TOPIC 0
+
+// names one joined client, a later client that gets the same fd gets another one
+// never 0 and fits in 24 bits, so it can be packed into callback args with a byte to spare
+typedef uint32_t websocket_hub_client;
+#define WEBSOCKET_HUB_NO_CLIENT 0
+
+typedef struct websocket_hub_stats {
+    uint32_t queued;
+    uint32_t coalesced;
+    uint32_t dropped;
+    uint32_t sent;
+} websocket_hub_stats;
+
+esp_err_t websocket_hub_init();
+// client may be NULL, the same client is found again with websocket_hub_find
+esp_err_t websocket_hub_join(int sockfd, websocket_hub_client *client);
+esp_err_t websocket_hub_leave(int sockfd);
+// the client joined on sockfd right now, WEBSOCKET_HUB_NO_CLIENT if none
+websocket_hub_client websocket_hub_find(int sockfd);
+// enqueue only, these never block on the network
+esp_err_t websocket_hub_broadcast(uint8_t topic, uint8_t opcode, const uint8_t *data, size_t length);
+// ESP_ERR_NOT_FOUND once the client has left, even if its fd was reused
+esp_err_t websocket_hub_send(websocket_hub_client client, uint8_t topic, uint8_t opcode, const uint8_t *data, size_t length);
+void websocket_hub_get_stats(websocket_hub_stats *stats);
+// per connection lock so frames from the session task and the hub do not interleave
+// on one socket, NULL for sockets that never joined since the hub never writes those
+// the hub keeps it while a frame it started is still partly unsent, which lasts as long
+// as the client does not read, so ESP_ERR_TIMEOUT once timeout passes without it
+esp_err_t websocket_hub_lock(int sockfd, TickType_t timeout, SemaphoreHandle_t *lock);
+void websocket_hub_unlock(SemaphoreHandle_t lock);
+
+#endif
@@ -1,40 +1,92 @@
 #include "websocket.h"
 #include "websocket_io.h"
 #include "websocket_handshake.h"
+#include "websocket_session.h"
+#include "websocket_hub.h"
 
 #include <esp_http_server.h>
-#include <esp_httpd_priv.h>
 #include <esp_log.h>
 
 #include <string.h>
+#include <lwip/sockets.h>
 #include <mbedtls/sha1.h>
 #include <mbedtls/base64.h>
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/semphr.h>
 
 #define TAG "websocket-io"
 
-#define PROTOCOL_BUFFER_SIZE 125
-// #define MIN(x, y) ((x > y) ? y : x)
-
-static uint8_t write_buffer[PROTOCOL_BUFFER_SIZE+2] = {0};
-static uint8_t read_buffer[PROTOCOL_BUFFER_SIZE+2] = {0};
-static uint8_t exit_response[2] = {0x80, 0x00};
-
-static esp_err_t websocket_read_data(httpd_req_t *request);
+int websocket_encode_header(uint8_t *header, uint8_t opcode, size_t length) {
+    header[0] = 0x80 | opcode;
+    if (length < 126) {
+        header[1] = length;
+        return 2;
+    }
+    if (length <= 0xFFFF) {
+        header[1] = 126;
+        header[2] = (length >> 8) & 0xFF;
+        header[3] = length & 0xFF;
+        return 4;
+    }
+    header[1] = 127;
+    for (int i = 0; i < 8; i++) {
+        header[2+i] = ((uint64_t)length >> (56 - 8*i)) & 0xFF;
+    }
+    return 10;
+}
 
-esp_err_t websocket_write(httpd_req_t *request, char *data, int _length, uint8_t opcode) {
-    uint8_t length = MIN(PROTOCOL_BUFFER_SIZE, _length);
-    write_buffer[0] = 0x80 | opcode;
-    write_buffer[1] = length;
-    memcpy(&write_buffer[2], data, length);
+esp_err_t websocket_send(int sockfd, uint8_t opcode, const uint8_t *data, size_t length) {
+    uint8_t header[WEBSOCKET_MAX_HEADER_SIZE];
+    struct iovec vectors[2] = {
+        { .iov_base = header, .iov_len = websocket_encode_header(header, opcode, length) },
+        { .iov_base = (void *)data, .iov_len = length },
+    };
+    struct msghdr message = {
+        .msg_iov = vectors,
+        .msg_iovlen = (length > 0) ? 2 : 1,
+    };
+
+    // header and payload go out in one call, the payload is never staged
+    // a client that stalls here only holds up frames to itself, and the session task
+    // for no longer than its send timeout or WEBSOCKET_SEND_LOCK_MS
+    SemaphoreHandle_t lock;
+    if (websocket_hub_lock(sockfd, pdMS_TO_TICKS(WEBSOCKET_SEND_LOCK_MS), &lock) != ESP_OK) {
+        ESP_LOGI(TAG, "Socket %d still busy with a hub frame", sockfd);
+        return ESP_ERR_TIMEOUT;
+    }
+    while (message.msg_iovlen > 0) {
+        int sent = sendmsg(sockfd, &message, 0);
+        if (sent <= 0) {
+            websocket_hub_unlock(lock);
+            ESP_LOGI(TAG, "Failed send");
+            return ESP_FAIL;
+        }
+        while (message.msg_iovlen > 0 && sent >= (int)message.msg_iov->iov_len) {
+            sent -= message.msg_iov->iov_len;
+            message.msg_iov++;
+            message.msg_iovlen--;
+        }
+        if (message.msg_iovlen > 0) {
+            message.msg_iov->iov_base = (uint8_t *)message.msg_iov->iov_base + sent;
+            message.msg_iov->iov_len -= sent;
+        }
+    }
+    websocket_hub_unlock(lock);
+    return ESP_OK;
+}
 
-    if (httpd_send(request, (char *)write_buffer, length+2) <= 0) {
-        ESP_LOGI(TAG, "Failed send");
+esp_err_t websocket_write(websocket_session *session, char *data, int length, uint8_t opcode) {
+    if (length < 0) {
         return ESP_FAIL;
     }
-    return ESP_OK;
+    return websocket_send(session->sockfd, opcode, (uint8_t *)data, length);
+}
+
+void websocket_close(websocket_session *session, uint16_t code) {
+    uint8_t payload[2] = {code >> 8, code & 0xFF};
+    websocket_write(session, (char *)payload, sizeof(payload), WEBSOCKET_OPCODE_CLOSE);
 }
 
 esp_err_t websocket_handler(httpd_req_t *request) {
@@ -43,75 +95,25 @@ esp_err_t websocket_handler(httpd_req_t *request) {
         return ESP_FAIL;
     } 
 
-    if (perform_websocket_handshake(request) != ESP_OK) {
-        ESP_LOGE(TAG, "Failed handshake");
+    websocket_session *session = websocket_session_reserve();
+    if (session == NULL) {
+        ESP_LOGE(TAG, "No free websocket sessions");
+        httpd_resp_set_status(request, "503 Service Unavailable");
+        httpd_resp_send(request, "Too many websockets", -1);
         return ESP_FAIL;
     }
 
-
-    ESP_LOGI(TAG, "Starting websocket");
-    websocket_ctx *context = (websocket_ctx *)(request->user_ctx);
-    websocket_start_callback start_callback = (context != NULL) ? context->on_start : NULL;
-    websocket_exit_callback exit_callback = (context != NULL) ? context->on_exit : NULL;
-
-    if (start_callback != NULL) {
-        start_callback(request);
-    }
-    while (websocket_read_data(request) == ESP_OK) {
-
-    }
-    ESP_LOGI(TAG, "Closing websocket");
-    if (exit_callback != NULL) {
-        exit_callback(request);
-    }
-
-    return ESP_FAIL;
-}
-
-esp_err_t websocket_read_data(httpd_req_t *request) {
-    websocket_ctx *context = (websocket_ctx *)(request->user_ctx);
-    websocket_recieve_callback callback = (context != NULL) ? context->on_recieve : NULL;
-    if (callback == NULL) {
-        return ESP_OK;
+    if (perform_websocket_handshake(request) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed handshake");
+        websocket_session_release(session);
+        return ESP_FAIL;
     }
 
-    // struct httpd_req_aux *ra = request->aux;
-    // int total_data = ra->sd->recv_fn(ra->sd->handle, ra->sd->fd, (char *)read_buffer, sizeof(read_buffer), 0);
-    int total_data = httpd_recv_with_opt(request, (char *)read_buffer, sizeof(read_buffer), false);
-    // int total_data = httpd_recv_with_opt(request, (char *)read_buffer, sizeof(read_buffer), false);
-    ESP_LOGD(TAG, "httpd response: %d", total_data);
-    if (total_data >= 7) {            
-        uint8_t opcode = read_buffer[0] & 0x7F;
-        // unmask
-        switch (opcode) {
-        case WEBSOCKET_OPCODE_CONTINUATION:
-        case WEBSOCKET_OPCODE_BIN: 
-        case WEBSOCKET_OPCODE_TEXT: 
-        case WEBSOCKET_OPCODE_PING:
-            if (total_data > 6) {
-                total_data -= 6;
-                for (int i = 0; i < total_data; i++) {
-                    read_buffer[i+6] ^= read_buffer[2 + i % 4];
-                }
-                int8_t length = read_buffer[1] + 128;
-                if (opcode != WEBSOCKET_OPCODE_PING) {
-                    callback(request, opcode, &read_buffer[6], length);
-                } else {
-                    ESP_LOGI(TAG, "Client send ping");
-                    websocket_write(request, (char *)&read_buffer[6], length, WEBSOCKET_OPCODE_PONG);
-                }
-            }
-            break;
-        
-        case WEBSOCKET_OPCODE_CLOSE:
-            ESP_LOGE(TAG, "Client closing websocket");
-            return ESP_FAIL;
-        }
-    // invalid packet 
-    } else {
-        ESP_LOGE(TAG, "Websocket failed!");
-        websocket_write(request, (char *)exit_response, sizeof(exit_response), WEBSOCKET_OPCODE_BIN);
+    // the handler returns straight away, frames are serviced by the session task
+    if (websocket_session_open(request, session) != ESP_OK) {
+        websocket_session_release(session);
         return ESP_FAIL;
     }
+    ESP_LOGI(TAG, "Started websocket on socket %d", session->sockfd);
     return ESP_OK;
-}
\ No newline at end of file
+}
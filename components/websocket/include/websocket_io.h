@@ -6,7 +6,18 @@
 
 #include "websocket.h"
 
-esp_err_t websocket_write(httpd_req_t *request, char *data, int length, uint8_t opcode);
+#define WEBSOCKET_MAX_HEADER_SIZE 10
+// longest the session task waits for the hub to finish a frame on the same socket
+#ifndef WEBSOCKET_SEND_LOCK_MS
+#define WEBSOCKET_SEND_LOCK_MS 1000
+#endif
+
+// writes a final frame header for a server frame, returns the header length
+int websocket_encode_header(uint8_t *header, uint8_t opcode, size_t length);
+// ESP_ERR_TIMEOUT if the hub is stuck on a frame to a client that stopped reading
+esp_err_t websocket_send(int sockfd, uint8_t opcode, const uint8_t *data, size_t length);
+esp_err_t websocket_write(websocket_session *session, char *data, int length, uint8_t opcode);
+void websocket_close(websocket_session *session, uint16_t code);
 esp_err_t websocket_handler(httpd_req_t *request);
 
 #endif
\ No newline at end of file
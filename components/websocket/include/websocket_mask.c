@@ -0,0 +1,42 @@
+#include "websocket_mask.h"
+
+#include <string.h>
+
+void websocket_unmask(uint8_t *data, size_t length, const uint8_t *mask, uint32_t offset) {
+    // short commands are cheaper without the alignment setup
+    if (length < 16) {
+        for (size_t i = 0; i < length; i++) {
+            data[i] ^= mask[(offset + i) & 0x03];
+        }
+        return;
+    }
+
+    // bytewise until data is word aligned, the lx106 faults on unaligned word access
+    while (length > 0 && ((uintptr_t)data & 0x03)) {
+        *data++ ^= mask[offset++ & 0x03];
+        length--;
+    }
+
+    // rotate key so that it lines up with the aligned words
+    uint8_t rotated[4];
+    for (int i = 0; i < 4; i++) {
+        rotated[i] = mask[(offset + i) & 0x03];
+    }
+    uint32_t key;
+    memcpy(&key, rotated, sizeof(key));
+
+    // memcpy keeps the access legal for strict aliasing, gcc turns it into l32i/s32i
+    size_t total_words = length / 4;
+    for (size_t i = 0; i < total_words; i++) {
+        uint32_t word;
+        memcpy(&word, data + i * 4, sizeof(word));
+        word ^= key;
+        memcpy(data + i * 4, &word, sizeof(word));
+    }
+
+    data += total_words * 4;
+    length -= total_words * 4;
+    for (size_t i = 0; i < length; i++) {
+        data[i] ^= rotated[i];
+    }
+}
@@ -0,0 +1,10 @@
+#ifndef __WEBSOCKET_MASK_H__
+#define __WEBSOCKET_MASK_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+// xor data with the 4 byte masking key, offset is the position of data within the payload
+void websocket_unmask(uint8_t *data, size_t length, const uint8_t *mask, uint32_t offset);
+
+#endif
@@ -0,0 +1,195 @@
+#include "websocket.h"
+#include "websocket_parser.h"
+#include "websocket_mask.h"
+
+#include <esp_log.h>
+
+#include <stddef.h>
+#include <string.h>
+
+#define TAG "websocket-parser"
+
+#define PARSER_STATE_OPCODE 0
+#define PARSER_STATE_LENGTH 1
+#define PARSER_STATE_EXTENDED_LENGTH 2
+#define PARSER_STATE_MASK 3
+#define PARSER_STATE_PAYLOAD 4
+
+#define IS_CONTROL_OPCODE(x) ((x) & 0x08)
+
+static esp_err_t websocket_parser_begin_payload(websocket_parser *parser, int position);
+static esp_err_t websocket_parser_end_payload(websocket_parser *parser, websocket_frame_callback callback, void *args);
+
+void websocket_parser_init(websocket_parser *parser) {
+    memset(parser, 0, offsetof(websocket_parser, buffer));
+    parser->state = PARSER_STATE_OPCODE;
+}
+
+uint8_t *websocket_parser_buffer(websocket_parser *parser, int *available) {
+    *available = WEBSOCKET_PARSER_BUFFER_SIZE - parser->length;
+    if (*available <= 0) {
+        return NULL;
+    }
+    return &parser->buffer[parser->length];
+}
+
+esp_err_t websocket_parser_feed(websocket_parser *parser, int length, websocket_frame_callback callback, void *args) {
+    uint8_t *buffer = parser->buffer;
+    int position = parser->length;
+    int end = parser->length + length;
+    esp_err_t status = ESP_OK;
+
+    while (position < end && status == ESP_OK) {
+        uint8_t byte;
+        switch (parser->state) {
+        case PARSER_STATE_OPCODE:
+            byte = buffer[position++];
+            // no extensions are negotiated so reserved bits must be clear
+            if (byte & 0x70) {
+                ESP_LOGE(TAG, "Reserved bits set: 0x%02x", byte);
+                return ESP_ERR_INVALID_ARG;
+            }
+            parser->fin = (byte & 0x80) != 0;
+            parser->opcode = byte & 0x0F;
+            parser->state = PARSER_STATE_LENGTH;
+            break;
+
+        case PARSER_STATE_LENGTH:
+            byte = buffer[position++];
+            // clients must always mask their frames
+            if (!(byte & 0x80)) {
+                ESP_LOGE(TAG, "Recieved unmasked frame");
+                return ESP_ERR_INVALID_ARG;
+            }
+            byte &= 0x7F;
+            parser->payload_remaining = 0;
+            parser->header_index = 0;
+            if (byte == 126) {
+                parser->header_index = 2;
+                parser->state = PARSER_STATE_EXTENDED_LENGTH;
+            } else if (byte == 127) {
+                parser->header_index = 8;
+                parser->state = PARSER_STATE_EXTENDED_LENGTH;
+            } else {
+                parser->payload_remaining = byte;
+                parser->state = PARSER_STATE_MASK;
+            }
+            break;
+
+        case PARSER_STATE_EXTENDED_LENGTH:
+            parser->payload_remaining = (parser->payload_remaining << 8) | buffer[position++];
+            if (--parser->header_index == 0) {
+                parser->state = PARSER_STATE_MASK;
+            }
+            break;
+
+        case PARSER_STATE_MASK:
+            parser->mask[parser->header_index++] = buffer[position++];
+            if (parser->header_index == 4) {
+                status = websocket_parser_begin_payload(parser, position);
+                if (status == ESP_OK && parser->payload_remaining == 0) {
+                    status = websocket_parser_end_payload(parser, callback, args);
+                }
+            }
+            break;
+
+        case PARSER_STATE_PAYLOAD: {
+            int total = end - position;
+            if (parser->payload_remaining < (uint64_t)total) {
+                total = (int)parser->payload_remaining;
+            }
+            uint8_t *data = &buffer[position];
+            websocket_unmask(data, total, parser->mask, parser->payload_offset);
+            if (IS_CONTROL_OPCODE(parser->opcode)) {
+                memcpy(&parser->control[parser->control_length], data, total);
+                parser->control_length += total;
+            } else {
+                // only fragments or frames split by a header need to be shifted down
+                uint8_t *message_end = &buffer[parser->message_start + parser->message_length];
+                if (message_end != data) {
+                    memmove(message_end, data, total);
+                }
+                parser->message_length += total;
+            }
+            position += total;
+            parser->payload_offset += total;
+            parser->payload_remaining -= total;
+            if (parser->payload_remaining == 0) {
+                status = websocket_parser_end_payload(parser, callback, args);
+            }
+            break;
+        }
+        }
+    }
+
+    // keep only the partially recieved message, at the front of the buffer
+    if (parser->message_active) {
+        if (parser->message_start != 0) {
+            memmove(buffer, &buffer[parser->message_start], parser->message_length);
+            parser->message_start = 0;
+        }
+        parser->length = parser->message_length;
+    } else {
+        parser->length = 0;
+    }
+    return status;
+}
+
+esp_err_t websocket_parser_begin_payload(websocket_parser *parser, int position) {
+    uint8_t opcode = parser->opcode;
+    parser->payload_offset = 0;
+    parser->state = PARSER_STATE_PAYLOAD;
+
+    switch (opcode) {
+    case WEBSOCKET_OPCODE_CLOSE:
+    case WEBSOCKET_OPCODE_PING:
+    case WEBSOCKET_OPCODE_PONG:
+        if (!parser->fin || parser->payload_remaining > WEBSOCKET_CONTROL_PAYLOAD_SIZE) {
+            ESP_LOGE(TAG, "Invalid control frame 0x%02x", opcode);
+            return ESP_ERR_INVALID_ARG;
+        }
+        parser->control_length = 0;
+        return ESP_OK;
+
+    case WEBSOCKET_OPCODE_CONTINUATION:
+        if (!parser->message_active) {
+            ESP_LOGE(TAG, "Continuation without a message");
+            return ESP_ERR_INVALID_ARG;
+        }
+        break;
+
+    case WEBSOCKET_OPCODE_TEXT:
+    case WEBSOCKET_OPCODE_BIN:
+        if (parser->message_active) {
+            ESP_LOGE(TAG, "New message before previous finished");
+            return ESP_ERR_INVALID_ARG;
+        }
+        parser->message_active = true;
+        parser->message_opcode = opcode;
+        parser->message_start = position;
+        parser->message_length = 0;
+        break;
+
+    default:
+        ESP_LOGE(TAG, "Unknown opcode 0x%02x", opcode);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (parser->payload_remaining > (uint64_t)(WEBSOCKET_PARSER_BUFFER_SIZE - parser->message_length)) {
+        ESP_LOGE(TAG, "Message too large for %d byte buffer", WEBSOCKET_PARSER_BUFFER_SIZE);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return ESP_OK;
+}
+
+esp_err_t websocket_parser_end_payload(websocket_parser *parser, websocket_frame_callback callback, void *args) {
+    parser->state = PARSER_STATE_OPCODE;
+    if (IS_CONTROL_OPCODE(parser->opcode)) {
+        return callback(args, parser->opcode, parser->control, parser->control_length);
+    }
+    if (!parser->fin) {
+        return ESP_OK;
+    }
+    parser->message_active = false;
+    return callback(args, parser->message_opcode, &parser->buffer[parser->message_start], parser->message_length);
+}
@@ -0,0 +1,49 @@
+#ifndef __WEBSOCKET_PARSER_H__
+#define __WEBSOCKET_PARSER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <esp_err.h>
+
+// largest (reassembled) message a connection can receive
+#ifndef WEBSOCKET_PARSER_BUFFER_SIZE
+#define WEBSOCKET_PARSER_BUFFER_SIZE 512
+#endif
+
+// rfc6455 limits control frames to 125 bytes of payload
+#define WEBSOCKET_CONTROL_PAYLOAD_SIZE 125
+
+// called once per control frame and once per complete (defragmented) data message
+// data points into the parser buffer and is only valid during the callback
+typedef esp_err_t (*websocket_frame_callback) (void *args, uint8_t opcode, uint8_t *data, int length);
+
+typedef struct websocket_parser {
+    uint8_t state;
+    uint8_t opcode;
+    bool fin;
+    uint8_t mask[4];
+    uint8_t header_index;
+    uint64_t payload_remaining;
+    uint32_t payload_offset;
+    // data message being assembled in place inside buffer
+    bool message_active;
+    uint8_t message_opcode;
+    int message_start;
+    int message_length;
+    // control frames can be interleaved with fragments so are kept aside
+    uint8_t control[WEBSOCKET_CONTROL_PAYLOAD_SIZE];
+    int control_length;
+    // raw bytes are received straight into here
+    int length;
+    uint8_t buffer[WEBSOCKET_PARSER_BUFFER_SIZE];
+} websocket_parser;
+
+void websocket_parser_init(websocket_parser *parser);
+// free space to recv into, returns NULL if the buffer is full
+uint8_t *websocket_parser_buffer(websocket_parser *parser, int *available);
+// parse length bytes just written into the space given by websocket_parser_buffer
+// ESP_ERR_INVALID_ARG on a protocol error, ESP_ERR_INVALID_SIZE if a message is too large
+// otherwise the first non ESP_OK status returned by the callback
+esp_err_t websocket_parser_feed(websocket_parser *parser, int length, websocket_frame_callback callback, void *args);
+
+#endif
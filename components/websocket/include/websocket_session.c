@@ -0,0 +1,198 @@
+#include "websocket.h"
+#include "websocket_io.h"
+#include "websocket_session.h"
+
+#include <esp_http_server.h>
+#include <esp_log.h>
+
+#include <string.h>
+#include <lwip/sockets.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define TAG "websocket-session"
+
+static websocket_session sessions[WEBSOCKET_MAX_SESSIONS];
+static TaskHandle_t session_task = NULL;
+
+static void websocket_session_task(void *args);
+static esp_err_t websocket_session_read(websocket_session *session);
+static void websocket_session_close(websocket_session *session);
+static esp_err_t websocket_session_on_frame(void *args, uint8_t opcode, uint8_t *data, int length);
+
+esp_err_t websocket_session_init() {
+    if (session_task != NULL) {
+        return ESP_OK;
+    }
+    if (xTaskCreate(websocket_session_task, "ws-session-task", WEBSOCKET_SESSION_STACK_SIZE, NULL, 5, &session_task) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+websocket_session *websocket_session_reserve() {
+    websocket_session *session = NULL;
+    portENTER_CRITICAL();
+    for (int i = 0; i < WEBSOCKET_MAX_SESSIONS; i++) {
+        if (sessions[i].state == WEBSOCKET_SESSION_FREE) {
+            session = &sessions[i];
+            session->state = WEBSOCKET_SESSION_PENDING;
+            session->sockfd = -1;
+            break;
+        }
+    }
+    portEXIT_CRITICAL();
+    return session;
+}
+
+void websocket_session_release(websocket_session *session) {
+    session->sockfd = -1;
+    session->state = WEBSOCKET_SESSION_FREE;
+}
+
+esp_err_t websocket_session_open(httpd_req_t *request, websocket_session *session) {
+    session->context = (websocket_ctx *)(request->user_ctx);
+    websocket_parser_init(&session->parser);
+
+    // httpd would parse the next frame as a request, so it drops the socket once this
+    // request is done and websocket_session_close_fn passes it to the session task
+    int sockfd = httpd_req_to_sockfd(request);
+    if (httpd_sess_trigger_close(request->handle, sockfd) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to detach socket %d", sockfd);
+        return ESP_FAIL;
+    }
+    session->sockfd = sockfd;
+    return ESP_OK;
+}
+
+void websocket_session_close_fn(httpd_handle_t handle, int sockfd) {
+    for (int i = 0; i < WEBSOCKET_MAX_SESSIONS; i++) {
+        websocket_session *session = &sessions[i];
+        if (session->state == WEBSOCKET_SESSION_PENDING && session->sockfd == sockfd) {
+            // also outside the httpd socket table, so lru purge never closes a websocket
+            websocket_ctx *context = session->context;
+            if (context != NULL && context->on_start != NULL) {
+                context->on_start(session);
+            }
+            session->state = WEBSOCKET_SESSION_OPEN;
+            xTaskNotifyGive(session_task);
+            return;
+        }
+    }
+    close(sockfd);
+}
+
+void websocket_session_task(void *args) {
+    for (;;) {
+        fd_set read_set;
+        FD_ZERO(&read_set);
+        int max_fd = -1;
+        for (int i = 0; i < WEBSOCKET_MAX_SESSIONS; i++) {
+            if (sessions[i].state == WEBSOCKET_SESSION_OPEN) {
+                FD_SET(sessions[i].sockfd, &read_set);
+                max_fd = MAX(max_fd, sessions[i].sockfd);
+            }
+        }
+        if (max_fd < 0) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        // sessions opened meanwhile are picked up on the next pass
+        struct timeval timeout = {
+            .tv_sec = 0,
+            .tv_usec = WEBSOCKET_SESSION_POLL_MS * 1000,
+        };
+        int ready = select(max_fd + 1, &read_set, NULL, NULL, &timeout);
+        if (ready < 0) {
+            ESP_LOGE(TAG, "Select failed: %d", errno);
+            vTaskDelay(pdMS_TO_TICKS(WEBSOCKET_SESSION_POLL_MS));
+            continue;
+        }
+        ulTaskNotifyTake(pdTRUE, 0);
+        for (int i = 0; i < WEBSOCKET_MAX_SESSIONS && ready > 0; i++) {
+            websocket_session *session = &sessions[i];
+            if (session->state != WEBSOCKET_SESSION_OPEN || !FD_ISSET(session->sockfd, &read_set)) {
+                continue;
+            }
+            ready--;
+            if (websocket_session_read(session) != ESP_OK) {
+                websocket_session_close(session);
+            }
+        }
+    }
+}
+
+esp_err_t websocket_session_read(websocket_session *session) {
+    int available = 0;
+    uint8_t *buffer = websocket_parser_buffer(&session->parser, &available);
+    if (buffer == NULL) {
+        ESP_LOGE(TAG, "Message exceeds %d bytes", WEBSOCKET_PARSER_BUFFER_SIZE);
+        websocket_close(session, WEBSOCKET_CLOSE_TOO_BIG);
+        return ESP_FAIL;
+    }
+
+    // only called once select has marked the socket readable, so this does not block
+    // a single recv can hold several frames, or only part of one
+    int total_data = recv(session->sockfd, buffer, available, 0);
+    ESP_LOGD(TAG, "socket %d recieved: %d", session->sockfd, total_data);
+    if (total_data <= 0) {
+        ESP_LOGI(TAG, "Socket %d closed", session->sockfd);
+        return ESP_FAIL;
+    }
+
+    esp_err_t status = websocket_parser_feed(&session->parser, total_data, websocket_session_on_frame, session);
+    switch (status) {
+    case ESP_OK:
+        return ESP_OK;
+    case ESP_ERR_INVALID_SIZE:
+        websocket_close(session, WEBSOCKET_CLOSE_TOO_BIG);
+        return ESP_FAIL;
+    case ESP_ERR_INVALID_ARG:
+        websocket_close(session, WEBSOCKET_CLOSE_PROTOCOL_ERROR);
+        return ESP_FAIL;
+    default:
+        return ESP_FAIL;
+    }
+}
+
+esp_err_t websocket_session_on_frame(void *args, uint8_t opcode, uint8_t *data, int length) {
+    websocket_session *session = (websocket_session *)args;
+    websocket_ctx *context = session->context;
+    websocket_recieve_callback callback = (context != NULL) ? context->on_recieve : NULL;
+
+    switch (opcode) {
+    case WEBSOCKET_OPCODE_BIN:
+    case WEBSOCKET_OPCODE_TEXT:
+        if (callback != NULL) {
+            callback(session, opcode, data, length);
+        }
+        return ESP_OK;
+
+    case WEBSOCKET_OPCODE_PING:
+        ESP_LOGI(TAG, "Client send ping");
+        websocket_write(session, (char *)data, length, WEBSOCKET_OPCODE_PONG);
+        return ESP_OK;
+
+    case WEBSOCKET_OPCODE_PONG:
+        return ESP_OK;
+
+    case WEBSOCKET_OPCODE_CLOSE:
+        // echo back the status code of the client
+        ESP_LOGI(TAG, "Client closing websocket");
+        websocket_write(session, (char *)data, MIN(length, 2), WEBSOCKET_OPCODE_CLOSE);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+void websocket_session_close(websocket_session *session) {
+    ESP_LOGI(TAG, "Closing websocket on socket %d", session->sockfd);
+    websocket_ctx *context = session->context;
+    if (context != NULL && context->on_exit != NULL) {
+        context->on_exit(session);
+    }
+    close(session->sockfd);
+    websocket_session_release(session);
+}
@@ -0,0 +1,26 @@
+#ifndef __WEBSOCKET_SESSION_H__
+#define __WEBSOCKET_SESSION_H__
+
+#include <esp_http_server.h>
+#include <esp_err.h>
+
+#include "websocket.h"
+
+// open sessions are serviced by one task, so frames never wait on page loads
+#ifndef WEBSOCKET_SESSION_STACK_SIZE
+#define WEBSOCKET_SESSION_STACK_SIZE 4096
+#endif
+// how long a session opened while the task is in select waits for its first frame
+#ifndef WEBSOCKET_SESSION_POLL_MS
+#define WEBSOCKET_SESSION_POLL_MS 50
+#endif
+
+esp_err_t websocket_session_init();
+// takes over the socket of an upgraded request, called after the handshake
+esp_err_t websocket_session_open(httpd_req_t *request, websocket_session *session);
+// httpd close_fn, hands the socket of an opened session to the task instead of closing it
+void websocket_session_close_fn(httpd_handle_t handle, int sockfd);
+websocket_session *websocket_session_reserve();
+void websocket_session_release(websocket_session *session);
+
+#endif
@@ -0,0 +1,84 @@
+// compares websocket_unmask with the bytewise loop the parser used before
+// build and run on the host with `make bench`
+#include "websocket_mask.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_LENGTH 65536
+// bytes processed per size, so every size takes about as long
+#define WORK_BYTES 200000000L
+
+static void unmask_bytewise(uint8_t *data, size_t length, const uint8_t *mask, uint32_t offset) {
+    for (size_t i = 0; i < length; i++) {
+        data[i] ^= mask[(offset + i) % 4];
+    }
+}
+
+static double now() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static int check() {
+    static uint8_t expected[512 + 8];
+    static uint8_t actual[512 + 8];
+    const uint8_t mask[4] = {0x37, 0xfa, 0x21, 0x3d};
+    for (int align = 0; align < 4; align++) {
+        for (uint32_t offset = 0; offset < 4; offset++) {
+            for (size_t length = 0; length <= 512; length++) {
+                for (size_t i = 0; i < sizeof(expected); i++) {
+                    expected[i] = actual[i] = i * 13;
+                }
+                unmask_bytewise(&expected[align], length, mask, offset);
+                websocket_unmask(&actual[align], length, mask, offset);
+                if (memcmp(expected, actual, sizeof(expected)) != 0) {
+                    printf("mismatch: align %d offset %u length %zu\n", align, offset, length);
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+int main() {
+    if (check() != 0) {
+        return 1;
+    }
+
+    static uint8_t buffer[MAX_LENGTH];
+    for (int i = 0; i < MAX_LENGTH; i++) {
+        buffer[i] = i * 13;
+    }
+    const uint8_t mask[4] = {0x37, 0xfa, 0x21, 0x3d};
+    const size_t sizes[] = {8, 32, 125, 512, 4096, 65536};
+    volatile uint8_t sink = 0;
+
+    printf("%8s %12s %12s %8s\n", "bytes", "bytewise", "words", "speedup");
+    for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+        size_t length = sizes[k];
+        long iterations = WORK_BYTES / (length + 16);
+
+        double start = now();
+        for (long i = 0; i < iterations; i++) {
+            unmask_bytewise(buffer, length, mask, 0);
+            sink ^= buffer[0];
+        }
+        double bytewise = now() - start;
+
+        start = now();
+        for (long i = 0; i < iterations; i++) {
+            websocket_unmask(buffer, length, mask, 0);
+            sink ^= buffer[0];
+        }
+        double words = now() - start;
+
+        printf("%8zu %9.3f ns/B %9.3f ns/B %7.1fx\n", length,
+            bytewise * 1e9 / iterations / length, words * 1e9 / iterations / length, bytewise / words);
+    }
+    return 0;
+}
@@ -25,19 +25,27 @@
 #include "nvs_flash.h"
 
 #include "shifted_pwm.h"
+#include "shifted_pwm_animation.h"
 #include "wifi_sta.h"
 #include "pc_io.h"
 #include "dht11.h"
+#include "dht11_sampler.h"
+#include "sensor_history.h"
 
 #include "websocket.h"
 #include "websocket_io.h"
+#include "websocket_hub.h"
 #include "websocket_listener.h"
 
 #include "web_server/server.h"
 
 #define INIT_TAG "initialisation"
 
-static httpd_handle_t websocket = NULL;
+static void record_history(const dht11_reading *reading, void *args);
+
+// sensor 0 is the one history and subscriptions follow
+static dht11_sensor dht_sensors[1];
+
 static httpd_handle_t webserver = NULL;
 
 static websocket_ctx websocket_uri_context = {
@@ -56,7 +64,8 @@ static httpd_uri_t websocket_uri = {
 void app_main()
 {
     ESP_LOGI(INIT_TAG, "Entering main function!\n");
-    shifted_pwm_init();
+    shifted_pwm_init(SHIFTED_PWM_MODE_BAM);
+    shifted_pwm_animation_init();
 
     ESP_LOGI(INIT_TAG, "Starting NVS!\n");
     esp_err_t nvs_status = nvs_flash_init();
@@ -66,17 +75,36 @@ void app_main()
     }
 
     wifi_init_sta();
-    dht11_init();
+    dht11_sensor_init(&dht_sensors[0], DHT11_PIN, DHT11_TYPE_DHT11);
+    dht11_sampler_add_dht(&dht_sensors[0]);
+    dht11_sampler_init();
+    sensor_history_init(true);
+    dht11_sampler_listen(record_history, NULL);
     pc_io_init();
 
-    for (int i = 0; i < 8; i++) {
-        set_pwm_value(i, 0);
+    shifted_pwm_lock_stage();
+    for (int i = 0; i < MAX_PWM_PINS; i++) {
+        stage_pwm_value(i, 0);
     }
+    shifted_pwm_commit();
+    shifted_pwm_unlock_stage();
+
+    websocket_hub_init();
+    listen_websocket_init();
 
-    websocket = start_websocket(3200);
+    // one server instance for both the ui and the websocket
     webserver = start_webserver(80);
-    httpd_register_uri_handler(websocket, &websocket_uri);
+    if (webserver != NULL) {
+        websocket_register(webserver, &websocket_uri);
+    }
     // vTaskStartScheduler();
     // ESP_LOGI(INIT_TAG, "Starting task scheduler!\n");
     ESP_LOGI(INIT_TAG, "Finished initialisation!");
-}
\ No newline at end of file
+    ESP_LOGI(INIT_TAG, "Free heap: %d bytes, minimum: %d bytes", esp_get_free_heap_size(), esp_get_minimum_free_heap_size());
+}
+
+void record_history(const dht11_reading *reading, void *args) {
+    if (reading->sensor == 0) {
+        sensor_history_add(reading->temperature, reading->humidity);
+    }
+}
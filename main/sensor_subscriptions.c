@@ -0,0 +1,149 @@
+#include "sensor_subscriptions.h"
+#include "dht11_sampler.h"
+#include "websocket.h"
+#include "websocket_hub.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define TAG "sensor-subscriptions"
+
+typedef struct subscription {
+    // WEBSOCKET_HUB_NO_CLIENT for a free slot
+    websocket_hub_client client;
+    uint32_t interval_ms;
+    uint8_t temperature_delta;
+    uint8_t humidity_delta;
+    // what the client was last sent in tenths, pushes are relative to that
+    bool pushed;
+    int16_t temperature;
+    uint16_t humidity;
+    int64_t push_time;
+} subscription;
+
+static subscription subscriptions[WEBSOCKET_MAX_SESSIONS];
+static SemaphoreHandle_t subscriptions_lock = NULL;
+
+static void sensor_reading_listener(const dht11_reading *reading, void *args);
+static bool should_push(const subscription *subscription, const dht11_reading *reading, int64_t now);
+static void push_reading(subscription *subscription, const dht11_reading *reading, int64_t now);
+
+esp_err_t sensor_subscriptions_init() {
+    for (int i = 0; i < WEBSOCKET_MAX_SESSIONS; i++) {
+        subscriptions[i].client = WEBSOCKET_HUB_NO_CLIENT;
+    }
+    subscriptions_lock = xSemaphoreCreateMutex();
+    if (subscriptions_lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    // one listener serves every subscriber, like the pc_io status broadcast
+    return dht11_sampler_listen(sensor_reading_listener, NULL);
+}
+
+esp_err_t sensor_subscribe(websocket_hub_client client, uint32_t interval_ms, uint8_t temperature_delta, uint8_t humidity_delta) {
+    if (interval_ms == 0 && temperature_delta == 0 && humidity_delta == 0) {
+        sensor_unsubscribe(client);
+        return ESP_OK;
+    }
+    if (client == WEBSOCKET_HUB_NO_CLIENT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t status = ESP_ERR_NO_MEM;
+    xSemaphoreTake(subscriptions_lock, portMAX_DELAY);
+    subscription *free_slot = NULL;
+    subscription *slot = NULL;
+    for (int i = 0; i < WEBSOCKET_MAX_SESSIONS; i++) {
+        if (subscriptions[i].client == client) {
+            slot = &subscriptions[i];
+        } else if (subscriptions[i].client == WEBSOCKET_HUB_NO_CLIENT && free_slot == NULL) {
+            free_slot = &subscriptions[i];
+        }
+    }
+    if (slot == NULL) {
+        slot = free_slot;
+    }
+    if (slot != NULL) {
+        slot->client = client;
+        slot->interval_ms = interval_ms;
+        slot->temperature_delta = temperature_delta;
+        slot->humidity_delta = humidity_delta;
+        slot->pushed = false;
+        // a new subscriber starts with the current reading
+        dht11_reading reading;
+        dht11_sampler_get(&reading);
+        if (reading.timestamp != 0) {
+            push_reading(slot, &reading, esp_timer_get_time());
+        }
+        status = ESP_OK;
+    }
+    xSemaphoreGive(subscriptions_lock);
+    return status;
+}
+
+void sensor_unsubscribe(websocket_hub_client client) {
+    if (subscriptions_lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(subscriptions_lock, portMAX_DELAY);
+    for (int i = 0; i < WEBSOCKET_MAX_SESSIONS; i++) {
+        if (subscriptions[i].client == client) {
+            subscriptions[i].client = WEBSOCKET_HUB_NO_CLIENT;
+        }
+    }
+    xSemaphoreGive(subscriptions_lock);
+}
+
+void sensor_reading_listener(const dht11_reading *reading, void *args) {
+    if (reading->sensor != 0) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    xSemaphoreTake(subscriptions_lock, portMAX_DELAY);
+    for (int i = 0; i < WEBSOCKET_MAX_SESSIONS; i++) {
+        subscription *subscription = &subscriptions[i];
+        if (subscription->client != WEBSOCKET_HUB_NO_CLIENT && should_push(subscription, reading, now)) {
+            push_reading(subscription, reading, now);
+        }
+    }
+    xSemaphoreGive(subscriptions_lock);
+}
+
+bool should_push(const subscription *subscription, const dht11_reading *reading, int64_t now) {
+    if (!subscription->pushed) {
+        return true;
+    }
+    bool interval_passed = (now - subscription->push_time) >= (int64_t)subscription->interval_ms * 1000;
+    if (subscription->temperature_delta == 0 && subscription->humidity_delta == 0) {
+        return interval_passed;
+    }
+
+    // stable readings send nothing at all, deltas are whole units
+    int temperature_change = abs((int)reading->temperature - subscription->temperature);
+    int humidity_change = abs((int)reading->humidity - subscription->humidity);
+    bool changed = (subscription->temperature_delta != 0 && temperature_change >= subscription->temperature_delta * 10)
+        || (subscription->humidity_delta != 0 && humidity_change >= subscription->humidity_delta * 10);
+    return changed && interval_passed;
+}
+
+void push_reading(subscription *subscription, const dht11_reading *reading, int64_t now) {
+    uint16_t temperature = (uint16_t)reading->temperature;
+    uint8_t frame[6] = {
+        SENSOR_PUSH_CMD, SENSOR_READING,
+        temperature >> 8, temperature & 0xFF,
+        reading->humidity >> 8, reading->humidity & 0xFF,
+    };
+    if (websocket_hub_send(subscription->client, SENSOR_READING_TOPIC, WEBSOCKET_OPCODE_BIN, frame, sizeof(frame)) != ESP_OK) {
+        ESP_LOGD(TAG, "Failed to queue reading for client 0x%06x", (unsigned int)subscription->client);
+        return;
+    }
+    subscription->pushed = true;
+    subscription->temperature = reading->temperature;
+    subscription->humidity = reading->humidity;
+    subscription->push_time = now;
+}
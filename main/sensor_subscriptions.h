@@ -0,0 +1,23 @@
+#ifndef __SENSOR_SUBSCRIPTIONS_H__
+#define __SENSOR_SUBSCRIPTIONS_H__
+
+#include <stdint.h>
+#include <esp_err.h>
+
+#include "websocket_hub.h"
+
+// readings are pushed as [SENSOR_PUSH_CMD][SENSOR_READING][temperature:2][humidity:2]
+// in tenths and big endian like SENSOR_STATUS, the temperature is signed
+#define SENSOR_PUSH_CMD 0x04
+#define SENSOR_READING 0x03
+// hub topic, a client that is behind only gets the newest reading
+#define SENSOR_READING_TOPIC 0x02
+
+esp_err_t sensor_subscriptions_init();
+// with deltas a reading is pushed once it moved that far, at most every interval_ms
+// without deltas it is pushed every interval_ms, all zero unsubscribes
+// subscriptions belong to a hub client, so a later client on the same fd gets none of them
+esp_err_t sensor_subscribe(websocket_hub_client client, uint32_t interval_ms, uint8_t temperature_delta, uint8_t humidity_delta);
+void sensor_unsubscribe(websocket_hub_client client);
+
+#endif
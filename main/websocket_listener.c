@@ -1,136 +1,555 @@
 #include "websocket_listener.h"
+#include "websocket_hub.h"
 
 #include "shifted_pwm.h"
+#include "shifted_pwm_animation.h"
 #include "pc_io.h"
 #include "pc_io_interrupt.h"
+#include "pc_io_log.h"
 #include "dht11.h"
+#include "dht11_sampler.h"
+#include "sensor_history.h"
+#include "sensor_subscriptions.h"
 
 #include <esp_log.h>
+#include <esp_timer.h>
 
+#include <stdlib.h>
+#include <string.h>
+
+// v2 frames hold several [seq:2][length:1][command] records, big endian seq
+// replies come back batched as [seq:2][length:1][v1 reply] in the same order
+// a reply length of 0 means the command was handled but has nothing to report
+// a deferred command that found the queue full replies [cmd][subcommand] and gets no frame
+#define PROTOCOL_V2 0x80
+#define V2_RECORD_HEADER_SIZE 3
+
+#define SENSOR_CMD 0x04
 #define DHT11_CMD 0x03
 #define PC_IO_CMD 0x02
 #define LED_CMD 0x01
 
+// without arguments the v1 reply, otherwise a subcommand
+// [humidity][temperature][age_ms:4][reads:4][failures:4], age is 0xFFFFFFFF before the first read
+// values of the primary sensor in whole units, SENSOR_STATUS has every sensor in tenths
+#define DHT11_STATUS 0x01
+// a sensor that failed this many reads in a row is reported as missing
+#define DHT11_MAX_FAILURES 3
+
+// [tier][from_ago_s:4][to_ago_s:4], answered in a frame of its own since it can be large
+// the batch reply comes first with an empty record for it, then this frame
+// [SENSOR_CMD][SENSOR_HISTORY][seq:2][tier][count:2] then per entry [age_s:4] and
+// raw: [temperature:2][humidity:2], rollups: temperature and humidity [min:2][max:2][avg:2]
+// values are in tenths, seq is that of the v2 record or 0 for v1
+#define SENSOR_HISTORY 0x01
+#define SENSOR_HISTORY_HEADER_SIZE 7
+// [interval_ms:4][temperature_delta][humidity_delta], replies [SENSOR_CMD][SENSOR_SUBSCRIBE][ok]
+// readings are then pushed as SENSOR_READING frames, see sensor_subscriptions.h
+// with deltas only changes that large are pushed, at most every interval
+// without deltas every interval, all zero unsubscribes
+#define SENSOR_SUBSCRIBE 0x02
+// [bus_us:4][budget_us:4][count] then per sensor [temperature:2][humidity:2] in tenths
+// bus_us is how long reads held the lines during the last second, a missing sensor reads 0x8000
+#define SENSOR_STATUS 0x04
+#define SENSOR_MISSING 0x8000
+#define SENSOR_STATUS_SIZE(sensors) (11 + 4 * (sensors))
+
 #define PC_IO_OFF   0x01
 #define PC_IO_ON    0x02
 #define PC_IO_RESET 0x03
 #define PC_IO_STATUS 0x04
+// [edges:4][dropped:4][transitions:4][last_latency_us:4][max_latency_us:4] of the status pin
+#define PC_IO_STATS 0x05
+// hard off, wait and power on as one queued command
+#define PC_IO_CYCLE 0x06
+// OFF, ON, RESET and CYCLE reply whether they were queued, and then push
+// [PC_IO_CMD][PC_IO_PROGRESS][cmd][step][steps][ok] to the requester after every step
+#define PC_IO_PROGRESS 0x07
+// answered in a frame of its own after the reply, [PC_IO_CMD][PC_IO_LOG][seq:2] then for powering off and on
+// [samples:4][failures:4][last_ms:4][min_ms:4][max_ms:4][avg_ms:4] from switch to status pin,
+// then [count] and oldest first [age_ms:4][type][value], see pc_io_log.h
+#define PC_IO_LOG 0x08
+#define PC_IO_LOG_HEADER_SIZE (4 + 2 * 24 + 1)
+// read in behind the header and encoded forward in place like the history, word aligned
+#define PC_IO_LOG_ENTRIES_OFFSET ((PC_IO_LOG_HEADER_SIZE + 3) & ~3)
 
 #define LED_SET 0x01
 #define LED_GET 0x02
+// same as LED_SET, but values are perceived brightness
+#define LED_SET_GAMMA 0x03
+// [curve][duration_ms:2] then (pin, value) pairs, all fade together on the device
+#define LED_FADE 0x04
+// [pin][curve][loop] then (value, duration_ms:2) keyframes
+#define LED_KEYFRAMES 0x05
+// isr counters, and with [pin] the on/period ticks that pin is really output with
+// only in builds with SHIFTED_PWM_STATS, otherwise there is no reply
+#define LED_STATS 0x06
+
+// coalescing topics for frames pushed through the hub, SENSOR_READING_TOPIC is 0x02
+#define PC_IO_STATUS_TOPIC 0x01
+
+// large replies are deferred and sent in frames of their own after the reply
+// to the frame that asked for them, so clients see replies in request order
+// a frame asking for more than MAX_DEFERRED of them is told to ask again for the rest
+#define MAX_DEFERRED 4
+#define DEFERRED_COMMAND_SIZE 16
 
-static void handle_dht11(httpd_req_t *request, uint8_t opcode, uint8_t *data, int length);
-static void handle_pc_io(httpd_req_t *request, uint8_t opcode, uint8_t *data, int length);
-static void handle_led(httpd_req_t *request, uint8_t opcode, uint8_t *data, int length);
+typedef struct deferred_command {
+    uint16_t seq;
+    uint8_t length;
+    // the command code followed by its data
+    uint8_t data[DEFERRED_COMMAND_SIZE];
+} deferred_command;
 
-#define REPLY_BUFFER_SIZE 100
+// handlers write their reply into reply and return its length, 0 for no reply
+static int handle_command(websocket_session *session, uint8_t opcode, uint16_t seq, uint8_t *data, int length, uint8_t *reply);
+static int handle_sensor(websocket_session *session, uint8_t opcode, uint16_t seq, uint8_t *data, int length, uint8_t *reply);
+static void send_sensor_history(websocket_session *session, uint8_t opcode, uint16_t seq, uint8_t *data, int length);
+static int defer_command(uint16_t seq, uint8_t cmd_code, uint8_t *data, int length, uint8_t *reply);
+static void send_deferred(websocket_session *session, uint8_t opcode);
+static int handle_sensor_status(uint8_t *reply);
+static int handle_dht11(uint8_t *data, int length, uint8_t *reply);
+static int handle_pc_io(websocket_session *session, uint8_t opcode, uint16_t seq, uint8_t *data, int length, uint8_t *reply);
+static void send_pc_io_log(websocket_session *session, uint8_t opcode, uint16_t seq);
+static int handle_led(uint8_t *data, int length, uint8_t *reply);
+static void handle_batch(websocket_session *session, uint8_t opcode, uint8_t *data, int length);
+static void write_u32(uint8_t *buffer, uint32_t value);
+static void write_u16(uint8_t *buffer, uint16_t value);
+static uint32_t read_u32(uint8_t *buffer);
+
+// largest reply of a single command
+#define REPLY_BUFFER_SIZE MAX(MAX(3 + MAX_PWM_PINS, 30), SENSOR_STATUS_SIZE(DHT11_SAMPLER_MAX_SENSORS))
 static uint8_t reply_buffer[REPLY_BUFFER_SIZE] = {0};
+#define BATCH_BUFFER_SIZE 256
+#if REPLY_BUFFER_SIZE + V2_RECORD_HEADER_SIZE > BATCH_BUFFER_SIZE
+#error "the largest reply does not fit in a batch, lower DHT11_SAMPLER_MAX_SENSORS or SHIFTED_PWM_REGISTERS"
+#endif
+static uint8_t batch_buffer[BATCH_BUFFER_SIZE] = {0};
+static deferred_command deferred[MAX_DEFERRED];
+static int total_deferred = 0;
+
+// history entries are read into the back of the frame and encoded forward in place,
+// an encoded entry is never longer than a sensor_history_entry so it never overtakes them
+#define SENSOR_HISTORY_MAX_LENGTH MAX(MAX(SENSOR_HISTORY_RAW_LENGTH, SENSOR_HISTORY_MINUTE_LENGTH), SENSOR_HISTORY_HOUR_LENGTH)
+#define FRAME_ENTRIES_OFFSET 8
+#define SENSOR_HISTORY_FRAME_SIZE (FRAME_ENTRIES_OFFSET + SENSOR_HISTORY_MAX_LENGTH * sizeof(sensor_history_entry))
+#define PC_IO_LOG_FRAME_SIZE (PC_IO_LOG_ENTRIES_OFFSET + PC_IO_LOG_LENGTH * sizeof(pc_io_log_entry))
+#define FRAME_BUFFER_SIZE MAX(SENSOR_HISTORY_FRAME_SIZE, PC_IO_LOG_FRAME_SIZE)
+// only the websocket session task sends deferred frames, so one buffer is enough
+static uint8_t frame_buffer[FRAME_BUFFER_SIZE] __attribute__((aligned(4)));
 static void pc_io_status_listener(bool is_powered, void *args);
+static void pc_io_progress_listener(const pc_io_progress *progress, void *args);
 
-esp_err_t listen_websocket_data(httpd_req_t *request, uint8_t opcode, uint8_t *data, int length) {
+esp_err_t listen_websocket_data(websocket_session *session, uint8_t opcode, uint8_t *data, int length) {
     if (length < 1) {
         return ESP_FAIL;
     }
 
+    if (data[0] == PROTOCOL_V2) {
+        handle_batch(session, opcode, &data[1], length-1);
+        send_deferred(session, opcode);
+        return ESP_OK;
+    }
+
+    int reply_length = handle_command(session, opcode, 0, data, length, reply_buffer);
+    if (reply_length > 0) {
+        websocket_write(session, (char *)reply_buffer, reply_length, opcode);
+    }
+    send_deferred(session, opcode);
+    return ESP_OK;
+}
+
+esp_err_t listen_websocket_init() {
+    // one listener fans out to every connection through the hub
+    esp_err_t status = pc_io_status_listen(pc_io_status_listener, NULL);
+    if (status != ESP_OK) {
+        return status;
+    }
+    return sensor_subscriptions_init();
+}
+
+esp_err_t listen_websocket_start(websocket_session *session) {
+    return websocket_hub_join(session->sockfd, NULL);
+}
+
+esp_err_t listen_websocket_exit(websocket_session *session) {
+    sensor_unsubscribe(websocket_hub_find(session->sockfd));
+    return websocket_hub_leave(session->sockfd);
+}
+
+
+int handle_command(websocket_session *session, uint8_t opcode, uint16_t seq, uint8_t *data, int length, uint8_t *reply) {
+    if (length < 1) {
+        return 0;
+    }
+
     uint8_t cmd_code = data[0];
     uint8_t *cmd_data = &data[1];
     int cmd_length = length-1;
 
     switch (cmd_code) {
-    case LED_CMD:   handle_led(request, opcode, cmd_data, cmd_length); break;
-    case PC_IO_CMD: handle_pc_io(request, opcode, cmd_data, cmd_length); break;
-    case DHT11_CMD: handle_dht11(request, opcode, cmd_data, cmd_length); break;
-    default:        ESP_LOGD("websocket-listener", "Unknown cmd: 0x%02x", cmd_code); break;
+    case LED_CMD:   return handle_led(cmd_data, cmd_length, reply);
+    case PC_IO_CMD: return handle_pc_io(session, opcode, seq, cmd_data, cmd_length, reply);
+    case DHT11_CMD: return handle_dht11(cmd_data, cmd_length, reply);
+    case SENSOR_CMD: return handle_sensor(session, opcode, seq, cmd_data, cmd_length, reply);
+    default:        ESP_LOGD("websocket-listener", "Unknown cmd: 0x%02x", cmd_code); return 0;
     }
+}
 
-    return ESP_OK;
+void handle_batch(websocket_session *session, uint8_t opcode, uint8_t *data, int length) {
+    int total_reply = 1;
+    batch_buffer[0] = PROTOCOL_V2;
+
+    int offset = 0;
+    while (offset + V2_RECORD_HEADER_SIZE <= length) {
+        uint8_t *record = &data[offset];
+        int record_length = record[2];
+        offset += V2_RECORD_HEADER_SIZE;
+        if (offset + record_length > length) {
+            ESP_LOGD("websocket-listener", "Truncated v2 record");
+            break;
+        }
+
+        // send what is batched so far rather than overflow the frame
+        if (total_reply + V2_RECORD_HEADER_SIZE + REPLY_BUFFER_SIZE > BATCH_BUFFER_SIZE) {
+            websocket_write(session, (char *)batch_buffer, total_reply, opcode);
+            total_reply = 1;
+        }
+
+        uint8_t *reply = &batch_buffer[total_reply];
+        reply[0] = record[0];
+        reply[1] = record[1];
+        uint16_t seq = (record[0] << 8) | record[1];
+        reply[2] = handle_command(session, opcode, seq, &data[offset], record_length, &reply[V2_RECORD_HEADER_SIZE]);
+        total_reply += V2_RECORD_HEADER_SIZE + reply[2];
+        offset += record_length;
+    }
+
+    if (total_reply > 1) {
+        websocket_write(session, (char *)batch_buffer, total_reply, opcode);
+    }
 }
 
-esp_err_t listen_websocket_start(httpd_req_t *request) {
-    return pc_io_status_listen(pc_io_status_listener, (void *)request);
+int handle_sensor(websocket_session *session, uint8_t opcode, uint16_t seq, uint8_t *data, int length, uint8_t *reply) {
+    if (length < 1) {
+        return 0;
+    }
+
+    switch (data[0]) {
+    case SENSOR_HISTORY:
+        return defer_command(seq, SENSOR_CMD, data, length, reply);
+    case SENSOR_SUBSCRIBE:
+        if (length < 7) {
+            return 0;
+        }
+        reply[0] = SENSOR_CMD;
+        reply[1] = SENSOR_SUBSCRIBE;
+        reply[2] = sensor_subscribe(websocket_hub_find(session->sockfd), read_u32(&data[1]), data[5], data[6]) == ESP_OK;
+        return 3;
+    case SENSOR_STATUS:
+        return handle_sensor_status(reply);
+    default:
+        return 0;
+    }
 }
 
-esp_err_t listen_websocket_exit(httpd_req_t *request) {
-    return pc_io_status_unlisten(pc_io_status_listener, (void *)request);
+int defer_command(uint16_t seq, uint8_t cmd_code, uint8_t *data, int length, uint8_t *reply) {
+    if (total_deferred >= MAX_DEFERRED || length + 1 > DEFERRED_COMMAND_SIZE) {
+        ESP_LOGD("websocket-listener", "Rejected deferred cmd: 0x%02x", cmd_code);
+        reply[0] = cmd_code;
+        reply[1] = data[0];
+        return 2;
+    }
+    deferred_command *command = &deferred[total_deferred++];
+    command->seq = seq;
+    command->length = length + 1;
+    command->data[0] = cmd_code;
+    memcpy(&command->data[1], data, length);
+    return 0;
 }
 
+void send_deferred(websocket_session *session, uint8_t opcode) {
+    for (int i = 0; i < total_deferred; i++) {
+        deferred_command *command = &deferred[i];
+        // data[1] is the subcommand, which the handlers checked before deferring
+        switch (command->data[0]) {
+        case SENSOR_CMD: send_sensor_history(session, opcode, command->seq, &command->data[2], command->length - 2); break;
+        case PC_IO_CMD:  send_pc_io_log(session, opcode, command->seq); break;
+        }
+    }
+    total_deferred = 0;
+}
 
-void handle_dht11(httpd_req_t *request, uint8_t opcode, uint8_t *data, int length) {
-    ESP_LOGD("dht11-websocket", "Got request");
-    reply_buffer[0] = DHT11_CMD;
-    if (dht11_read() != ESP_OK) {
-        reply_buffer[1] = 0xFF;
-        websocket_write(request, (char *)reply_buffer, 2, opcode);
+void send_sensor_history(websocket_session *session, uint8_t opcode, uint16_t seq, uint8_t *data, int length) {
+    if (length < 9 || data[0] >= SENSOR_HISTORY_TIERS) {
         return;
     }
-    reply_buffer[1] = dht11_get_humidity();
-    reply_buffer[2] = dht11_get_temperature();
-    websocket_write(request, (char *)reply_buffer, 3, opcode);
+    sensor_history_tier tier = data[0];
+    uint32_t from_ago = read_u32(&data[1]);
+    uint32_t to_ago = read_u32(&data[5]);
+
+    uint8_t *frame = frame_buffer;
+    sensor_history_entry *entries = (sensor_history_entry *)&frame_buffer[FRAME_ENTRIES_OFFSET];
+    int total = sensor_history_read(tier, from_ago, to_ago, entries, SENSOR_HISTORY_MAX_LENGTH);
+    int32_t now = sensor_history_now();
+    int size = SENSOR_HISTORY_HEADER_SIZE;
+    for (int i = 0; i < total; i++) {
+        // copied out first, the encoding may overwrite the start of this entry
+        sensor_history_entry entry = entries[i];
+        write_u32(&frame[size], now - entry.time);
+        size += 4;
+        if (tier == SENSOR_HISTORY_RAW) {
+            write_u16(&frame[size], entry.temperature_avg);
+            write_u16(&frame[size + 2], entry.humidity_avg);
+            size += 4;
+            continue;
+        }
+        write_u16(&frame[size], entry.temperature_min);
+        write_u16(&frame[size + 2], entry.temperature_max);
+        write_u16(&frame[size + 4], entry.temperature_avg);
+        write_u16(&frame[size + 6], entry.humidity_min);
+        write_u16(&frame[size + 8], entry.humidity_max);
+        write_u16(&frame[size + 10], entry.humidity_avg);
+        size += 12;
+    }
+    frame[0] = SENSOR_CMD;
+    frame[1] = SENSOR_HISTORY;
+    write_u16(&frame[2], seq);
+    frame[4] = tier;
+    write_u16(&frame[5], total);
+    websocket_write(session, (char *)frame, size, opcode);
 }
 
-void handle_pc_io(httpd_req_t *request, uint8_t opcode, uint8_t *data, int length) {
+int handle_sensor_status(uint8_t *reply) {
+    dht11_sampler_bus_stats stats;
+    dht11_sampler_get_bus_stats(&stats);
+    reply[0] = SENSOR_CMD;
+    reply[1] = SENSOR_STATUS;
+    write_u32(&reply[2], stats.bus_us);
+    write_u32(&reply[6], stats.budget_us);
+    // the reply buffer is sized for DHT11_SAMPLER_MAX_SENSORS, the most there can be
+    int count = dht11_sampler_count();
+    reply[10] = count;
+    for (int i = 0; i < count; i++) {
+        dht11_reading reading;
+        bool missing = dht11_sampler_get_sensor(i, &reading) != ESP_OK
+                || reading.timestamp == 0 || reading.consecutive_failures >= DHT11_MAX_FAILURES;
+        write_u16(&reply[SENSOR_STATUS_SIZE(i)], missing ? SENSOR_MISSING : (uint16_t)reading.temperature);
+        write_u16(&reply[SENSOR_STATUS_SIZE(i) + 2], missing ? 0 : reading.humidity);
+    }
+    return SENSOR_STATUS_SIZE(count);
+}
+
+int handle_dht11(uint8_t *data, int length, uint8_t *reply) {
+    ESP_LOGD("dht11-websocket", "Got request");
+    // answered from the sampler, the sensor itself is never read here
+    dht11_reading reading;
+    dht11_sampler_get(&reading);
+    reply[0] = DHT11_CMD;
+
+    if (length >= 1 && data[0] == DHT11_STATUS) {
+        uint32_t age_ms = 0xFFFFFFFF;
+        if (reading.timestamp != 0) {
+            age_ms = (esp_timer_get_time() - reading.timestamp) / 1000;
+        }
+        reply[1] = DHT11_STATUS;
+        reply[2] = reading.humidity / 10;
+        reply[3] = reading.temperature / 10;
+        write_u32(&reply[4], age_ms);
+        write_u32(&reply[8], reading.reads);
+        write_u32(&reply[12], reading.failures);
+        return 16;
+    }
+
+    if (reading.timestamp == 0 || reading.consecutive_failures >= DHT11_MAX_FAILURES) {
+        reply[1] = 0xFF;
+        return 2;
+    }
+    reply[1] = reading.humidity / 10;
+    reply[2] = reading.temperature / 10;
+    return 3;
+}
+
+int handle_pc_io(websocket_session *session, uint8_t opcode, uint16_t seq, uint8_t *data, int length, uint8_t *reply) {
     if (length < 1) {
-        return;
+        return 0;
     }
     uint8_t cmd = data[0];
     ESP_LOGD("pc-io-websocket", "Got command: 0x%02x", cmd);
+    if (cmd == PC_IO_LOG) {
+        return defer_command(seq, PC_IO_CMD, data, length, reply);
+    }
+    if (cmd == PC_IO_STATS) {
+        pc_io_interrupt_stats stats;
+        pc_io_interrupt_get_stats(&stats);
+        reply[0] = PC_IO_CMD;
+        reply[1] = PC_IO_STATS;
+        write_u32(&reply[2], stats.edges);
+        write_u32(&reply[6], stats.dropped);
+        write_u32(&reply[10], stats.transitions);
+        write_u32(&reply[14], stats.last_latency_us);
+        write_u32(&reply[18], stats.max_latency_us);
+        return 22;
+    }
+
+    // progress goes back to the client that asked, along with the command
+    // by hub client rather than fd, a cycle outlasts a client that leaves and its fd may be reused
+    void *progress_args = (void *)(uintptr_t)((websocket_hub_find(session->sockfd) << 8) | cmd);
     esp_err_t resp_status = ESP_OK;
     switch (cmd) {
-    case PC_IO_OFF:     resp_status = pc_io_power_off();    break;
-    case PC_IO_ON:      resp_status = pc_io_power_on();     break;
-    case PC_IO_RESET:   resp_status = pc_io_reset();        break;
+    case PC_IO_OFF:     resp_status = pc_io_submit(PC_IO_COMMAND_POWER_OFF, pc_io_progress_listener, progress_args);    break;
+    case PC_IO_ON:      resp_status = pc_io_submit(PC_IO_COMMAND_POWER_ON, pc_io_progress_listener, progress_args);     break;
+    case PC_IO_RESET:   resp_status = pc_io_submit(PC_IO_COMMAND_RESET, pc_io_progress_listener, progress_args);        break;
+    case PC_IO_CYCLE:   resp_status = pc_io_submit(PC_IO_COMMAND_POWER_CYCLE, pc_io_progress_listener, progress_args);  break;
     case PC_IO_STATUS:  pc_io_is_powered() ? (resp_status = ESP_OK) : (resp_status = ESP_FAIL); break;
-    default:            ESP_LOGI("pc-io-websocket", "Unknown command: 0x%02x", cmd); return;
+    default:            ESP_LOGI("pc-io-websocket", "Unknown command: 0x%02x", cmd); return 0;
     }
 
-    reply_buffer[0] = PC_IO_CMD;
-    reply_buffer[1] = cmd;
+    reply[0] = PC_IO_CMD;
+    reply[1] = cmd;
     
     if (resp_status == ESP_OK) {
-        reply_buffer[2] = 0x01;
+        reply[2] = 0x01;
     } else {
-        reply_buffer[2] = 0x00;
+        reply[2] = 0x00;
     }
-    websocket_write(request, (char *)reply_buffer, 3, opcode);
+    return 3;
 }
 
-void pc_io_status_listener(bool is_powered, void *args) {
-    httpd_req_t *request = (httpd_req_t *)args;
-    if (request == NULL) {
-        return;
+void send_pc_io_log(websocket_session *session, uint8_t opcode, uint16_t seq) {
+    uint8_t *frame = frame_buffer;
+    pc_io_log_entry *entries = (pc_io_log_entry *)&frame_buffer[PC_IO_LOG_ENTRIES_OFFSET];
+    frame[0] = PC_IO_CMD;
+    frame[1] = PC_IO_LOG;
+    write_u16(&frame[2], seq);
+    int size = 4;
+    for (int powered = 0; powered < 2; powered++) {
+        pc_io_latency_stats stats;
+        pc_io_log_get_latency(powered, &stats);
+        write_u32(&frame[size], stats.samples);
+        write_u32(&frame[size + 4], stats.failures);
+        write_u32(&frame[size + 8], stats.last_ms);
+        write_u32(&frame[size + 12], stats.min_ms);
+        write_u32(&frame[size + 16], stats.max_ms);
+        write_u32(&frame[size + 20], stats.avg_ms);
+        size += 24;
     }
 
-    reply_buffer[0] = PC_IO_CMD;
-    reply_buffer[1] = PC_IO_STATUS;
-    reply_buffer[2] = is_powered ? 0x01 : 0x00;
+    int total = pc_io_log_read(entries, PC_IO_LOG_LENGTH);
+    uint32_t now = pc_io_log_now();
+    frame[size++] = total;
+    for (int i = 0; i < total; i++) {
+        // copied out first, the encoding may overwrite the start of this entry
+        pc_io_log_entry entry = entries[i];
+        write_u32(&frame[size], now - entry.time);
+        frame[size + 4] = entry.type;
+        frame[size + 5] = entry.value;
+        size += 6;
+    }
+    websocket_write(session, (char *)frame, size, opcode);
+}
+
+void pc_io_progress_listener(const pc_io_progress *progress, void *args) {
+    websocket_hub_client client = (uintptr_t)args >> 8;
+    uint8_t cmd = (uintptr_t)args & 0xFF;
+    uint8_t frame[6] = {PC_IO_CMD, PC_IO_PROGRESS, cmd, progress->step, progress->steps, progress->status == ESP_OK};
+    // fails quietly if the client has gone in the meantime
+    websocket_hub_send(client, WEBSOCKET_HUB_NO_TOPIC, WEBSOCKET_OPCODE_BIN, frame, sizeof(frame));
+}
+
+void pc_io_status_listener(bool is_powered, void *args) {
+    uint8_t status[3] = {PC_IO_CMD, PC_IO_STATUS, is_powered ? 0x01 : 0x00};
     ESP_LOGD("websocket-listener-pc-io", "ISR is_powered: %d", is_powered);
-    websocket_write(request, (char *)reply_buffer, 3, WEBSOCKET_OPCODE_BIN);
+    // only the latest power state matters to a client that is behind
+    websocket_hub_broadcast(PC_IO_STATUS_TOPIC, WEBSOCKET_OPCODE_BIN, status, sizeof(status));
 }
 
-void handle_led(httpd_req_t *request, uint8_t opcode, uint8_t *data, int length) {
+int handle_led(uint8_t *data, int length, uint8_t *reply) {
     if (length < 1) {
-        return;
+        return 0;
     }
     uint8_t mode = data[0];
     if (mode == LED_GET) {
-        reply_buffer[0] = LED_CMD;
-        reply_buffer[1] = LED_GET;
-        reply_buffer[2] = MAX_PWM_PINS;
+        reply[0] = LED_CMD;
+        reply[1] = LED_GET;
+        reply[2] = MAX_PWM_PINS;
         for (int i = 0; i < MAX_PWM_PINS; i++) {
-            reply_buffer[3+i] = get_pwm_value(i);
+            reply[3+i] = get_pwm_value(i);
         }
-        websocket_write(request, (char *)reply_buffer, 3 + MAX_PWM_PINS, opcode);
-    } else if (mode == LED_SET) {
+        return 3 + MAX_PWM_PINS;
+    } else if (mode == LED_SET || mode == LED_SET_GAMMA) {
+        shifted_pwm_curve curve = (mode == LED_SET_GAMMA) ? SHIFTED_PWM_CURVE_GAMMA : SHIFTED_PWM_CURVE_LINEAR;
+        // the animation task commits too, it must not show half of this frame
+        shifted_pwm_lock_stage();
         for (int i = 1; i < length-1; i+=2) {
             uint8_t pin = data[i];
             uint8_t value = data[i+1];
             if (pin < MAX_PWM_PINS) {
-                set_pwm_value(pin, value);
+                shifted_pwm_stop(pin);
+                stage_pwm_value_curve(pin, value, curve);
             }
         }
+        // all pins of a frame change in the same pwm period
+        shifted_pwm_commit();
+        shifted_pwm_unlock_stage();
         // disable reply since limits bandwidth
         // reply_buffer[0] = LED_CMD;
         // reply_buffer[1] = LED_SET;
-        // websocket_write(request, (char *)reply_buffer, 2, opcode);
+        // websocket_write(session, (char *)reply_buffer, 2, opcode);
+#if SHIFTED_PWM_STATS
+    } else if (mode == LED_STATS) {
+        shifted_pwm_stats stats;
+        shifted_pwm_get_stats(&stats);
+        reply[0] = LED_CMD;
+        reply[1] = LED_STATS;
+        write_u32(&reply[2], stats.interrupts);
+        write_u32(&reply[6], stats.transfers);
+        write_u32(&reply[10], stats.periods);
+        write_u32(&reply[14], stats.interrupts ? stats.total_cycles / stats.interrupts : 0);
+        write_u32(&reply[18], stats.max_cycles);
+        if (length < 2 || data[1] >= MAX_PWM_PINS) {
+            return 22;
+        }
+        uint32_t on_ticks, period_ticks;
+        shifted_pwm_output_duty(data[1], &on_ticks, &period_ticks);
+        write_u32(&reply[22], on_ticks);
+        write_u32(&reply[26], period_ticks);
+        return 30;
+#endif
+    } else if (mode == LED_FADE && length >= 4) {
+        shifted_pwm_curve curve = data[1] ? SHIFTED_PWM_CURVE_GAMMA : SHIFTED_PWM_CURVE_LINEAR;
+        uint16_t duration_ms = (data[2] << 8) | data[3];
+        for (int i = 4; i < length-1; i+=2) {
+            shifted_pwm_fade(data[i], data[i+1], duration_ms, curve);
+        }
+    } else if (mode == LED_KEYFRAMES && length >= 4) {
+        shifted_pwm_keyframe keyframes[SHIFTED_PWM_MAX_KEYFRAMES];
+        int total_keyframes = 0;
+        for (int i = 4; i < length-2 && total_keyframes < SHIFTED_PWM_MAX_KEYFRAMES; i+=3) {
+            keyframes[total_keyframes].value = data[i];
+            keyframes[total_keyframes].duration_ms = (data[i+1] << 8) | data[i+2];
+            total_keyframes++;
+        }
+        shifted_pwm_curve curve = data[2] ? SHIFTED_PWM_CURVE_GAMMA : SHIFTED_PWM_CURVE_LINEAR;
+        if (shifted_pwm_animate(data[1], keyframes, total_keyframes, data[3] != 0, curve) != ESP_OK) {
+            ESP_LOGD("led-websocket", "Rejected keyframes for pin %d", data[1]);
+        }
     }
-}
\ No newline at end of file
+    return 0;
+}
+
+void write_u32(uint8_t *buffer, uint32_t value) {
+    buffer[0] = value >> 24;
+    buffer[1] = value >> 16;
+    buffer[2] = value >> 8;
+    buffer[3] = value;
+}
+
+void write_u16(uint8_t *buffer, uint16_t value) {
+    buffer[0] = value >> 8;
+    buffer[1] = value;
+}
+
+uint32_t read_u32(uint8_t *buffer) {
+    return ((uint32_t)buffer[0] << 24) | ((uint32_t)buffer[1] << 16) | ((uint32_t)buffer[2] << 8) | buffer[3];
+}
@@ -5,8 +5,9 @@
 #include "websocket_io.h"
 #include <esp_err.h>
 
-esp_err_t listen_websocket_start(httpd_req_t *request);
-esp_err_t listen_websocket_data(httpd_req_t *request, uint8_t opcode, uint8_t *data, int length);
-esp_err_t listen_websocket_exit(httpd_req_t *request);
+esp_err_t listen_websocket_init();
+esp_err_t listen_websocket_start(websocket_session *session);
+esp_err_t listen_websocket_data(websocket_session *session, uint8_t opcode, uint8_t *data, int length);
+esp_err_t listen_websocket_exit(websocket_session *session);
 
 #endif
\ No newline at end of file
@@ -1 +1 @@
-python /c/SPB_Data/esp/ESP8266_RTOS_SDK/components/esptool_py/esptool/esptool.py --chip esp8266 --port COM6 --baud 921600 --before default_reset --after hard_reset write_flash -z --flash_mode qio --flash_freq 40m --flash_size 4MB 0x0000 /c/Users/acidi/Downloads/Coding/LEDController/rtos_project/build/bootloader/bootloader.bin 0x10000 /c/Users/acidi/Downloads/Coding/LEDController/rtos_project/build/hello-world.bin 0x8000 /c/Users/acidi/Downloads/Coding/LEDController/rtos_project/build/partitions_singleapp.bin
\ No newline at end of file
+python /c/SPB_Data/esp/ESP8266_RTOS_SDK/components/esptool_py/esptool/esptool.py --chip esp8266 --port COM6 --baud 921600 --before default_reset --after hard_reset write_flash -z --flash_mode qio --flash_freq 40m --flash_size 4MB 0x0000 /c/Users/acidi/Downloads/Coding/LEDController/rtos_project/build/bootloader/bootloader.bin 0x10000 /c/Users/acidi/Downloads/Coding/LEDController/rtos_project/build/hello-world.bin 0x8000 /c/Users/acidi/Downloads/Coding/LEDController/rtos_project/build/partitions.bin 0x100000 /c/Users/acidi/Downloads/Coding/LEDController/rtos_project/build/www.bin
\ No newline at end of file